@@ -0,0 +1,191 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Lookup in unordered_flat_map with uint32, uint64 and uuid keys, with a
+// regular hash and with one producing few distinct reduced hashes, so that
+// most lookups compare several candidates of a group. Meant to be run
+// against alternative implementations of the candidate comparison loop in
+// table_core::find (see the comment there).
+
+#define _SILENCE_CXX17_OLD_ALLOCATOR_MEMBERS_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CISO646_REMOVED_WARNING
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+constexpr unsigned N = 1'000'000;
+constexpr int K = 10;
+
+struct uuid
+{
+    unsigned char data[ 16 ];
+
+    uuid(): data()
+    {
+    }
+
+    uuid( std::uint64_t low, std::uint64_t high ) noexcept
+    {
+        boost::endian::store_little_u64( data + 0, low );
+        boost::endian::store_little_u64( data + 8, high );
+    }
+
+    inline friend std::size_t hash_value( uuid const& u ) noexcept
+    {
+        std::uint64_t low  = boost::endian::load_little_u64( u.data + 0 );
+        std::uint64_t high = boost::endian::load_little_u64( u.data + 8 );
+
+        std::size_t r = 0;
+
+        boost::hash_combine( r, low );
+        boost::hash_combine( r, high );
+
+        return r;
+    }
+
+    inline friend bool operator==( uuid const& u1, uuid const& u2 ) noexcept
+    {
+        return std::memcmp( u1.data, u2.data, 16 ) == 0;
+    }
+};
+
+static void make_key( std::uint32_t& k, boost::detail::splitmix64& rng )
+{
+    k = static_cast<std::uint32_t>( rng() );
+}
+
+static void make_key( std::uint64_t& k, boost::detail::splitmix64& rng )
+{
+    k = rng();
+}
+
+static void make_key( uuid& k, boost::detail::splitmix64& rng )
+{
+    std::uint64_t low = rng();
+    k = uuid( low, rng() );
+}
+
+// well distributed positions, but only four distinct reduced hashes
+
+template<class Key> struct tag_colliding_hash
+{
+    using is_avalanching = void;
+
+    std::size_t operator()( Key const& x ) const noexcept
+    {
+        std::size_t h = static_cast<std::size_t>( boost::hash<Key>()( x ) * 0x9E3779B97F4A7C15ull );
+        return ( h & ~std::size_t( 0xFF ) ) | ( h & 3 );
+    }
+};
+
+// large mapped type stored apart from the keys with the split layout
+
+struct payload
+{
+    std::uint64_t data[ 16 ];
+};
+
+namespace boost
+{
+namespace unordered
+{
+
+template<> struct flat_map_split_layout<std::uint64_t, payload>: std::true_type
+{
+};
+
+} // namespace unordered
+} // namespace boost
+
+static std::uint64_t value_of( std::uint64_t x )
+{
+    return x;
+}
+
+static std::uint64_t value_of( payload const& x )
+{
+    return x.data[ 0 ];
+}
+
+struct record
+{
+    std::string label_;
+    long long time_;
+};
+
+static std::vector<record> times;
+
+template<class Key, class T, class Hash> BOOST_NOINLINE void test( char const* label )
+{
+    boost::unordered_flat_map<Key, T, Hash> map;
+    std::vector<Key> keys;
+
+    {
+        boost::detail::splitmix64 rng;
+
+        for( unsigned i = 0; i < N; ++i )
+        {
+            Key k;
+
+            make_key( k, rng );
+            map[ k ] = T{ i };
+            keys.push_back( k );
+
+            // not in the map (with high probability)
+
+            make_key( k, rng );
+            keys.push_back( k );
+        }
+    }
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::uint64_t s = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        for( auto const& k: keys )
+        {
+            auto it = map.find( k );
+            if( it != map.end() ) s += value_of( it->second );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << label << ": " << ( t2 - t1 ) / 1ms << " ms (s=" << s << ", size=" << map.size() << ")\n";
+
+    times.push_back( { label, ( t2 - t1 ) / 1ms } );
+}
+
+int main()
+{
+    test<std::uint32_t, std::uint64_t, boost::hash<std::uint32_t>>( "uint32" );
+    test<std::uint32_t, std::uint64_t, tag_colliding_hash<std::uint32_t>>( "uint32, tag collisions" );
+    test<std::uint64_t, std::uint64_t, boost::hash<std::uint64_t>>( "uint64" );
+    test<std::uint64_t, std::uint64_t, tag_colliding_hash<std::uint64_t>>( "uint64, tag collisions" );
+    test<std::uint64_t, payload, boost::hash<std::uint64_t>>( "uint64, split layout" );
+    test<std::uint64_t, payload, tag_colliding_hash<std::uint64_t>>( "uint64, split layout, tag collisions" );
+    test<uuid, std::uint64_t, boost::hash<uuid>>( "uuid" );
+    test<uuid, std::uint64_t, tag_colliding_hash<uuid>>( "uuid, tag collisions" );
+
+    std::cout << "---\n\n";
+
+    for( auto const& x: times )
+    {
+        std::cout << std::setw( 40 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms\n";
+    }
+}
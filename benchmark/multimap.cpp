@@ -0,0 +1,287 @@
+// Copyright 2021 Peter Dimov.
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Compile with -DBOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS to measure
+// boost::unordered_multimap with grouped equivalent elements.
+
+#define _SILENCE_CXX17_OLD_ALLOCATOR_MEMBERS_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CISO646_REMOVED_WARNING
+
+#include <boost/unordered_map.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+static void print_time( std::chrono::steady_clock::time_point & t1, char const* label, std::uint64_t s, std::size_t size )
+{
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << label << ": " << ( t2 - t1 ) / 1ms << " ms (s=" << s << ", size=" << size << ")\n";
+
+    t1 = t2;
+}
+
+// Inverted index-like distribution: a few keys with many values
+// each and a long tail of keys with a single value.
+
+constexpr unsigned N1 = 1'000;     // number of heavy keys
+constexpr unsigned M1 = 1'000;     // values per heavy key
+constexpr unsigned N2 = 1'000'000; // number of single-valued keys
+constexpr int K = 10;
+
+static std::vector< std::uint64_t > keys, values, lookups;
+
+static void init_indices()
+{
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N1; ++i )
+    {
+        keys.push_back( rng() );
+    }
+
+    for( unsigned i = 0; i < N2; ++i )
+    {
+        keys.push_back( rng() );
+    }
+
+    for( unsigned i = 0; i < N1 * M1 + N2; ++i )
+    {
+        values.push_back( rng() );
+    }
+
+    // half of the lookups are for keys not in the container
+
+    for( unsigned i = 0; i < N1 + N2; ++i )
+    {
+        lookups.push_back( i % 2? rng(): keys[ i ] );
+    }
+}
+
+template<class Map> BOOST_NOINLINE void test_insert( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    unsigned n = 0;
+
+    for( unsigned j = 0; j < M1; ++j )
+    {
+        for( unsigned i = 0; i < N1; ++i )
+        {
+            map.insert( { keys[ i ], values[ n++ ] } );
+        }
+    }
+
+    for( unsigned i = N1; i < N1 + N2; ++i )
+    {
+        map.insert( { keys[ i ], values[ n++ ] } );
+    }
+
+    print_time( t1, "Insert",  0, map.size() );
+
+    std::cout << std::endl;
+}
+
+template<class Map> BOOST_NOINLINE void test_lookup( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    std::uint64_t s;
+
+    s = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        for( unsigned i = 0; i < N1 + N2; ++i )
+        {
+            auto it = map.find( lookups[ i ] );
+            if( it != map.end() ) s += it->second;
+        }
+    }
+
+    print_time( t1, "find",  s, map.size() );
+
+    s = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        for( unsigned i = 0; i < N1 + N2; ++i )
+        {
+            s += map.count( lookups[ i ] );
+        }
+    }
+
+    print_time( t1, "count",  s, map.size() );
+
+    s = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        for( unsigned i = 0; i < N1 + N2; ++i )
+        {
+            auto r = map.equal_range( lookups[ i ] );
+            if( r.first != r.second ) s += r.first->second;
+        }
+    }
+
+    print_time( t1, "equal_range",  s, map.size() );
+
+    s = 0;
+
+    for( unsigned i = 0; i < N1; ++i )
+    {
+        auto r = map.equal_range( keys[ i ] );
+        for( auto it = r.first; it != r.second; ++it ) s += it->second;
+    }
+
+    print_time( t1, "equal_range traversal of heavy keys",  s, map.size() );
+
+    std::cout << std::endl;
+}
+
+template<class Map> BOOST_NOINLINE void test_rehash( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    map.rehash( map.bucket_count() * 2 );
+
+    print_time( t1, "rehash",  0, map.size() );
+
+    std::cout << std::endl;
+}
+
+template<class Map> BOOST_NOINLINE void test_erase( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    std::uint64_t s = 0;
+
+    for( unsigned i = 0; i < N1 + N2; ++i )
+    {
+        s += map.erase( lookups[ i ] );
+    }
+
+    print_time( t1, "erase(key)",  s, map.size() );
+
+    std::cout << std::endl;
+}
+
+// counting allocator
+
+static std::size_t s_alloc_bytes = 0;
+static std::size_t s_alloc_count = 0;
+
+template<class T> struct allocator
+{
+    using value_type = T;
+
+    allocator() = default;
+
+    template<class U> allocator( allocator<U> const & ) noexcept
+    {
+    }
+
+    template<class U> bool operator==( allocator<U> const & ) const noexcept
+    {
+        return true;
+    }
+
+    template<class U> bool operator!=( allocator<U> const& ) const noexcept
+    {
+        return false;
+    }
+
+    T* allocate( std::size_t n ) const
+    {
+        s_alloc_bytes += n * sizeof(T);
+        s_alloc_count++;
+
+        return std::allocator<T>().allocate( n );
+    }
+
+    void deallocate( T* p, std::size_t n ) const noexcept
+    {
+        s_alloc_bytes -= n * sizeof(T);
+        s_alloc_count--;
+
+        std::allocator<T>().deallocate( p, n );
+    }
+};
+
+//
+
+struct record
+{
+    std::string label_;
+    long long time_;
+    std::size_t bytes_;
+    std::size_t count_;
+};
+
+static std::vector<record> times;
+
+template<template<class...> class Map> BOOST_NOINLINE void test( char const* label )
+{
+    std::cout << label << ":\n\n";
+
+    s_alloc_bytes = 0;
+    s_alloc_count = 0;
+
+    Map<std::uint64_t, std::uint64_t> map;
+
+    auto t0 = std::chrono::steady_clock::now();
+    auto t1 = t0;
+
+    test_insert( map, t1 );
+
+    std::cout << "Memory: " << s_alloc_bytes << " bytes in " << s_alloc_count << " allocations\n\n";
+
+    record rec = { label, 0, s_alloc_bytes, s_alloc_count };
+
+    test_lookup( map, t1 );
+    test_rehash( map, t1 );
+    test_lookup( map, t1 );
+    test_erase( map, t1 );
+
+    auto tN = std::chrono::steady_clock::now();
+    std::cout << "Total: " << ( tN - t0 ) / 1ms << " ms\n\n";
+
+    rec.time_ = ( tN - t0 ) / 1ms;
+    times.push_back( rec );
+}
+
+// aliases using the counting allocator
+
+template<class K, class V> using allocator_for = ::allocator< std::pair<K const, V> >;
+
+template<class K, class V> using std_unordered_multimap =
+    std::unordered_multimap<K, V, std::hash<K>, std::equal_to<K>, allocator_for<K, V>>;
+
+template<class K, class V> using boost_unordered_multimap =
+    boost::unordered_multimap<K, V, boost::hash<K>, std::equal_to<K>, allocator_for<K, V>>;
+
+int main()
+{
+    init_indices();
+
+    test<std_unordered_multimap>( "std::unordered_multimap" );
+
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+
+    test<boost_unordered_multimap>( "boost::unordered_multimap (grouped)" );
+
+#else
+
+    test<boost_unordered_multimap>( "boost::unordered_multimap" );
+
+#endif
+
+    std::cout << "---\n\n";
+
+    for( auto const& x: times )
+    {
+        std::cout << std::setw( 40 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms, " << std::setw( 9 ) << x.bytes_ << " bytes in " << x.count_ << " allocations\n";
+    }
+}
@@ -0,0 +1,251 @@
+// Copyright 2021 Peter Dimov.
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Link with Boost.Serialization (-lboost_serialization).
+
+#define _SILENCE_CXX17_OLD_ALLOCATOR_MEMBERS_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CISO646_REMOVED_WARNING
+
+#include <boost/unordered_map.hpp>
+#include <boost/unordered/unordered_node_map.hpp>
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/concurrent_flat_map.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+constexpr std::size_t sizes[] = { 10'000, 100'000, 1'000'000 };
+constexpr int K = 5; // repetitions of each measurement (best time is taken)
+
+static std::vector< std::uint64_t > indices;
+
+static void init_indices()
+{
+    boost::detail::splitmix64 rng;
+
+    for( std::size_t i = 0; i < sizes[ sizeof( sizes ) / sizeof( sizes[ 0 ] ) - 1 ]; ++i )
+    {
+        indices.push_back( rng() );
+    }
+}
+
+// archive formats
+
+struct regular_format
+{
+    static constexpr char const* label = "regular";
+
+    template<class Archive, class Map> static void save( Archive& ar, Map const& map )
+    {
+        ar << boost::serialization::make_nvp( "map", map );
+    }
+
+    template<class Archive, class Map> static void load( Archive& ar, Map& map )
+    {
+        ar >> boost::serialization::make_nvp( "map", map );
+    }
+};
+
+struct layout_format
+{
+    static constexpr char const* label = "layout";
+
+    template<class Archive, class Map> static void save( Archive& ar, Map const& map )
+    {
+        map.save_layout( ar );
+    }
+
+    template<class Archive, class Map> static void load( Archive& ar, Map& map )
+    {
+        map.load_layout( ar );
+    }
+};
+
+struct compact_format
+{
+    static constexpr char const* label = "compact";
+
+    template<class Archive, class Map> static void save( Archive& ar, Map const& map )
+    {
+        map.save_compact( ar );
+    }
+
+    template<class Archive, class Map> static void load( Archive& ar, Map& map )
+    {
+        map.load_compact( ar );
+    }
+};
+
+struct snapshot_format
+{
+    static constexpr char const* label = "snapshot";
+
+    template<class Archive, class Map> static void save( Archive& ar, Map const& map )
+    {
+        map.save_snapshot( ar );
+    }
+
+    template<class Archive, class Map> static void load( Archive& ar, Map& map )
+    {
+        map.load_snapshot( ar );
+    }
+};
+
+struct binary_archive
+{
+    static constexpr char const* label = "binary";
+
+    using oarchive = boost::archive::binary_oarchive;
+    using iarchive = boost::archive::binary_iarchive;
+};
+
+struct text_archive
+{
+    static constexpr char const* label = "text";
+
+    using oarchive = boost::archive::text_oarchive;
+    using iarchive = boost::archive::text_iarchive;
+};
+
+//
+
+struct record
+{
+    std::string label_;
+    std::size_t size_;
+    std::size_t bytes_;
+    double save_time_;
+    double load_time_;
+};
+
+static std::vector<record> times;
+
+static double to_ms( std::chrono::steady_clock::duration d )
+{
+    return std::chrono::duration<double, std::milli>( d ).count();
+}
+
+static void print_throughput( char const* label, double ms, std::size_t bytes, std::size_t size )
+{
+    std::cout << label << ": " << std::fixed << std::setprecision( 2 ) << ms << " ms, "
+        << std::setprecision( 1 ) << bytes / ms / 1000 << " MB/s, "
+        << size / ms / 1000 << " M elements/s\n";
+}
+
+template<class Map> void fill( Map& map, std::size_t n )
+{
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        map.emplace( indices[ i ], i );
+    }
+}
+
+template<class Map, class Format, class Archive> BOOST_NOINLINE void test( char const* label )
+{
+    for( std::size_t n: sizes )
+    {
+        Map map;
+        fill( map, n );
+
+        std::string data;
+        auto save_time = std::chrono::steady_clock::duration::max();
+
+        for( int j = 0; j < K; ++j )
+        {
+            std::ostringstream os;
+
+            auto t1 = std::chrono::steady_clock::now();
+
+            {
+                typename Archive::oarchive oa( os );
+                Format::save( oa, map );
+            }
+
+            auto t2 = std::chrono::steady_clock::now();
+
+            save_time = std::min( save_time, t2 - t1 );
+            data = os.str();
+        }
+
+        auto load_time = std::chrono::steady_clock::duration::max();
+        std::size_t s = 0;
+
+        for( int j = 0; j < K; ++j )
+        {
+            Map map2;
+            std::istringstream is( data );
+
+            auto t1 = std::chrono::steady_clock::now();
+
+            {
+                typename Archive::iarchive ia( is );
+                Format::load( ia, map2 );
+            }
+
+            auto t2 = std::chrono::steady_clock::now();
+
+            load_time = std::min( load_time, t2 - t1 );
+            s = map2.size();
+        }
+
+        std::string full_label = std::string( label ) + ", " + Format::label + ", " + Archive::label;
+
+        std::cout << full_label << " (size=" << s << ", bytes=" << data.size() << "):\n\n";
+
+        print_throughput( "Save", to_ms( save_time ), data.size(), n );
+        print_throughput( "Load", to_ms( load_time ), data.size(), n );
+
+        std::cout << std::endl;
+
+        times.push_back( { full_label, n, data.size(), to_ms( save_time ), to_ms( load_time ) } );
+    }
+}
+
+template<class Map, class Format> void test( char const* label )
+{
+    test<Map, Format, binary_archive>( label );
+    test<Map, Format, text_archive>( label );
+}
+
+using boost_unordered_map = boost::unordered_map<std::uint64_t, std::uint64_t>;
+using boost_unordered_node_map = boost::unordered_node_map<std::uint64_t, std::uint64_t>;
+using boost_unordered_flat_map = boost::unordered_flat_map<std::uint64_t, std::uint64_t>;
+using boost_concurrent_flat_map = boost::concurrent_flat_map<std::uint64_t, std::uint64_t>;
+
+int main()
+{
+    init_indices();
+
+    test<boost_unordered_map, regular_format>( "boost::unordered_map" );
+    test<boost_unordered_node_map, regular_format>( "boost::unordered_node_map" );
+    test<boost_unordered_flat_map, regular_format>( "boost::unordered_flat_map" );
+    test<boost_unordered_flat_map, layout_format>( "boost::unordered_flat_map" );
+    test<boost_unordered_flat_map, compact_format>( "boost::unordered_flat_map" );
+    test<boost_concurrent_flat_map, regular_format>( "boost::concurrent_flat_map" );
+    test<boost_concurrent_flat_map, snapshot_format>( "boost::concurrent_flat_map" );
+    test<boost_concurrent_flat_map, layout_format>( "boost::concurrent_flat_map" );
+
+    std::cout << "---\n\n";
+
+    for( auto const& x: times )
+    {
+        std::cout << std::setw( 48 ) << ( x.label_ + ": " ) << std::setw( 8 ) << x.size_ << " elements, "
+            << std::setw( 10 ) << x.bytes_ << " bytes, save " << std::fixed << std::setprecision( 1 ) << std::setw( 8 )
+            << x.bytes_ / x.save_time_ / 1000 << " MB/s, load " << std::setw( 8 ) << x.bytes_ / x.load_time_ / 1000 << " MB/s\n";
+    }
+}
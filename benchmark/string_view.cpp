@@ -9,6 +9,7 @@
 #include <boost/unordered_map.hpp>
 #include <boost/unordered/unordered_node_map.hpp>
 #include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/string_hash.hpp>
 #include <boost/core/detail/splitmix64.hpp>
 #include <boost/config.hpp>
 #ifdef HAVE_ABSEIL
@@ -374,6 +375,17 @@ template<class K, class V> using ankerl_unordered_dense_map_fnv1a =
 
 #endif
 
+// boost::string_hash
+
+template<class K, class V> using boost_unordered_map_string_hash =
+    boost::unordered_map<K, V, boost::string_hash, std::equal_to<K>, allocator_for<K, V>>;
+
+template<class K, class V> using boost_unordered_node_map_string_hash =
+    boost::unordered_node_map<K, V, boost::string_hash, std::equal_to<K>, allocator_for<K, V>>;
+
+template<class K, class V> using boost_unordered_flat_map_string_hash =
+    boost::unordered_flat_map<K, V, boost::string_hash, std::equal_to<K>, allocator_for<K, V>>;
+
 //
 
 int main()
@@ -416,11 +428,15 @@ int main()
 
 #endif
 
+    test<boost_unordered_map_string_hash>( "boost::unordered_map, string_hash" );
+    test<boost_unordered_node_map_string_hash>( "boost::unordered_node_map, string_hash" );
+    test<boost_unordered_flat_map_string_hash>( "boost::unordered_flat_map, string_hash" );
+
     std::cout << "---\n\n";
 
     for( auto const& x: times )
     {
-        std::cout << std::setw( 38 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms, " << std::setw( 9 ) << x.bytes_ << " bytes in " << x.count_ << " allocations\n";
+        std::cout << std::setw( 42 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms, " << std::setw( 9 ) << x.bytes_ << " bytes in " << x.count_ << " allocations\n";
     }
 }
 
@@ -143,6 +143,42 @@ template<class Map> BOOST_NOINLINE void test_lookup( Map& map, std::chrono::stea
     std::cout << std::endl;
 }
 
+// each lookup depends on the result of the previous one, so that
+// latency rather than throughput is measured
+
+template<class Map> BOOST_NOINLINE void test_latency( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    std::uint32_t s;
+
+    s = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        for( unsigned i = 1; i <= N; ++i )
+        {
+            auto it = map.find( indices2[ i + ( s & 1 ) ] );
+            if( it != map.end() ) s += it->second;
+        }
+    }
+
+    print_time( t1, "Random dependent lookup (hit)",  s, map.size() );
+
+    s = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        for( unsigned i = N + 1; i < N * 2; ++i )
+        {
+            auto it = map.find( indices2[ i + ( s & 1 ) ] );
+            if( it != map.end() ) s += it->second; else ++s;
+        }
+    }
+
+    print_time( t1, "Random dependent lookup (miss)",  s, map.size() );
+
+    std::cout << std::endl;
+}
+
 template<class Map> BOOST_NOINLINE void test_iteration( Map& map, std::chrono::steady_clock::time_point & t1 )
 {
     auto it = map.begin();
@@ -270,6 +306,7 @@ template<template<class...> class Map> BOOST_NOINLINE void test( char const* lab
     record rec = { label, 0, s_alloc_bytes, s_alloc_count };
 
     test_lookup( map, t1 );
+    test_latency( map, t1 );
     test_iteration( map, t1 );
     test_lookup( map, t1 );
     test_erase( map, t1 );
@@ -297,6 +334,46 @@ template<class K, class V> using boost_unordered_node_map =
 template<class K, class V> using boost_unordered_flat_map =
     boost::unordered_flat_map<K, V, boost::hash<K>, std::equal_to<K>, allocator_for<K, V>>;
 
+// boost::hash with a mixing other than the default
+
+template<class K, boost::unordered::hash_mixing M> struct mixing_hash: boost::hash<K>
+{
+    static constexpr boost::unordered::hash_mixing mixing = M;
+};
+
+template<class K, class V> using boost_unordered_flat_map_mulx32 =
+    boost::unordered_flat_map<K, V, mixing_hash<K, boost::unordered::hash_mixing::mulx32>, std::equal_to<K>, allocator_for<K, V>>;
+
+template<class K, class V> using boost_unordered_flat_map_xmx =
+    boost::unordered_flat_map<K, V, mixing_hash<K, boost::unordered::hash_mixing::xmx>, std::equal_to<K>, allocator_for<K, V>>;
+
+// group metadata immediately followed by its elements, see
+// boost::unordered::flat_map_interleaved_layout; V is wrapped so that
+// the layout is only enabled for this alias
+
+template<class V> struct interleaved_value
+{
+    V v;
+
+    interleaved_value( V v_ = V() ): v( v_ ) {}
+    operator V() const { return v; }
+};
+
+namespace boost
+{
+namespace unordered
+{
+
+template<> struct flat_map_interleaved_layout< std::uint32_t, interleaved_value<std::uint32_t> >: std::true_type
+{
+};
+
+} // namespace unordered
+} // namespace boost
+
+template<class K, class V> using boost_unordered_flat_map_interleaved =
+    boost::unordered_flat_map<K, interleaved_value<V>, boost::hash<K>, std::equal_to<K>, allocator_for<K, interleaved_value<V>>>;
+
 #ifdef HAVE_ABSEIL
 
 template<class K, class V> using absl_node_hash_map =
@@ -322,6 +399,9 @@ int main()
     test<boost_unordered_map>( "boost::unordered_map" );
     test<boost_unordered_node_map>( "boost::unordered_node_map" );
     test<boost_unordered_flat_map>( "boost::unordered_flat_map" );
+    test<boost_unordered_flat_map_mulx32>( "boost::unordered_flat_map, mulx32" );
+    test<boost_unordered_flat_map_xmx>( "boost::unordered_flat_map, xmx" );
+    test<boost_unordered_flat_map_interleaved>( "boost::unordered_flat_map, interleaved" );
 
 #ifdef HAVE_ANKERL_UNORDERED_DENSE
 
@@ -340,7 +420,7 @@ int main()
 
     for( auto const& x: times )
     {
-        std::cout << std::setw( 30 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms, " << std::setw( 9 ) << x.bytes_ << " bytes in " << x.count_ << " allocations\n";
+        std::cout << std::setw( 40 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms, " << std::setw( 9 ) << x.bytes_ << " bytes in " << x.count_ << " allocations\n";
     }
 }
 
@@ -348,6 +348,16 @@ template<class K, class V> using boost_unordered_node_map =
 template<class K, class V> using boost_unordered_flat_map =
     boost::unordered_flat_map<K, V, boost::hash<K>, std::equal_to<K>, allocator_for<K, V>>;
 
+// boost::hash with a mixing other than the default
+
+template<class K, boost::unordered::hash_mixing M> struct mixing_hash: boost::hash<K>
+{
+    static constexpr boost::unordered::hash_mixing mixing = M;
+};
+
+template<class K, class V> using boost_unordered_flat_map_xmx =
+    boost::unordered_flat_map<K, V, mixing_hash<K, boost::unordered::hash_mixing::xmx>, std::equal_to<K>, allocator_for<K, V>>;
+
 #ifdef HAVE_ABSEIL
 
 template<class K, class V> using absl_node_hash_map =
@@ -373,6 +383,7 @@ int main()
     test<boost_unordered_map>( "boost::unordered_map" );
     test<boost_unordered_node_map>( "boost::unordered_node_map" );
     test<boost_unordered_flat_map>( "boost::unordered_flat_map" );
+    test<boost_unordered_flat_map_xmx>( "boost::unordered_flat_map, xmx" );
 
 #ifdef HAVE_ANKERL_UNORDERED_DENSE
 
@@ -391,7 +402,7 @@ int main()
 
     for( auto const& x: times )
     {
-        std::cout << std::setw( 30 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms, " << std::setw( 9 ) << x.bytes_ << " bytes in " << x.count_ << " allocations\n";
+        std::cout << std::setw( 40 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms, " << std::setw( 9 ) << x.bytes_ << " bytes in " << x.count_ << " allocations\n";
     }
 }
 
@@ -0,0 +1,140 @@
+// Copyright (C) 2026 agent
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNORDERED_ASYNC_SERIALIZATION_HPP_INCLUDED
+#define BOOST_UNORDERED_ASYNC_SERIALIZATION_HPP_INCLUDED
+
+#include <boost/config.hpp>
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#pragma once
+#endif
+
+#include <boost/unordered/concurrent_flat_map_fwd.hpp>
+#include <boost/unordered/concurrent_flat_set_fwd.hpp>
+#include <boost/unordered/detail/double_buffered_streambuf.hpp>
+
+#include <boost/core/serialization.hpp>
+
+#include <future>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+namespace boost {
+  namespace unordered {
+    namespace detail {
+      template <class Container>
+      struct is_concurrent_container : std::false_type
+      {
+      };
+
+      template <class Key, class T, class Hash, class Pred, class Allocator>
+      struct is_concurrent_container<
+        concurrent_flat_map<Key, T, Hash, Pred, Allocator> > : std::true_type
+      {
+      };
+
+      template <class Key, class Hash, class Pred, class Allocator>
+      struct is_concurrent_container<
+        concurrent_flat_set<Key, Hash, Pred, Allocator> > : std::true_type
+      {
+      };
+
+      // concurrent containers are saved as snapshots so that they're only
+      // held in a shared lock
+
+      template <class Archive, class Container>
+      void async_save_container(
+        Archive& ar, Container const& x, std::false_type /* concurrent */)
+      {
+        ar << core::make_nvp("container", x);
+      }
+
+      template <class Archive, class Container>
+      void async_save_container(
+        Archive& ar, Container const& x, std::true_type /* concurrent */)
+      {
+        x.save_snapshot(ar);
+      }
+
+      template <class Archive, class Container>
+      void async_load_container(
+        Archive& ar, Container& x, std::false_type /* concurrent */)
+      {
+        ar >> core::make_nvp("container", x);
+      }
+
+      template <class Archive, class Container>
+      void async_load_container(
+        Archive& ar, Container& x, std::true_type /* concurrent */)
+      {
+        x.load_snapshot(ar);
+      }
+
+      template <class Archive, class Container>
+      void double_buffered_save(std::ostream& os, Container const& x)
+      {
+        double_buffered_ostreambuf buf(*os.rdbuf());
+        {
+          std::ostream bos(&buf);
+          Archive ar(bos);
+          async_save_container(ar, x, is_concurrent_container<Container>{});
+        }
+        buf.close();
+      }
+
+      template <class Archive, class Container>
+      void double_buffered_load(std::istream& is, Container& x)
+      {
+        double_buffered_istreambuf buf(*is.rdbuf());
+        {
+          std::istream bis(&buf);
+          Archive ar(bis);
+          async_load_container(ar, x, is_concurrent_container<Container>{});
+        }
+        buf.close();
+      }
+    } // namespace detail
+
+    template <class Archive, class Container>
+    std::future<void> async_save(std::ostream& os, Container const& x)
+    {
+      return std::async(std::launch::async,
+        [&os, &x] { detail::double_buffered_save<Archive>(os, x); });
+    }
+
+    template <class Archive, class Container>
+    typename std::enable_if<!std::is_lvalue_reference<Container>::value,
+      std::future<Container> >::type
+    async_save(std::ostream& os, Container&& x)
+    {
+      return std::async(
+        std::launch::async,
+        [&os](Container&& y) {
+          detail::double_buffered_save<Archive>(os, y);
+          return std::move(y);
+        },
+        std::move(x));
+    }
+
+    template <class Archive, class Container>
+    std::future<Container> async_load(
+      std::istream& is, Container x = Container())
+    {
+      return std::async(
+        std::launch::async,
+        [&is](Container&& y) {
+          detail::double_buffered_load<Archive>(is, y);
+          return std::move(y);
+        },
+        std::move(x));
+    }
+  } // namespace unordered
+
+  using boost::unordered::async_load;
+  using boost::unordered::async_save;
+} // namespace boost
+
+#endif
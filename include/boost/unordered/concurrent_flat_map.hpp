@@ -16,6 +16,7 @@
 #include <boost/unordered/detail/concurrent_static_asserts.hpp>
 #include <boost/unordered/detail/foa/concurrent_table.hpp>
 #include <boost/unordered/detail/foa/flat_map_types.hpp>
+#include <boost/unordered/detail/serialize_compact.hpp>
 #include <boost/unordered/detail/type_traits.hpp>
 #include <boost/unordered/unordered_flat_map_fwd.hpp>
 
@@ -24,9 +25,12 @@
 #include <boost/core/serialization.hpp>
 
 #include <type_traits>
+#include <vector>
 
 namespace boost {
   namespace unordered {
+    BOOST_UNORDERED_INCREMENTAL_CHECKPOINTS_NAMESPACE_BEGIN
+
     template <class Key, class T, class Hash, class Pred, class Allocator>
     class concurrent_flat_map
     {
@@ -36,7 +40,7 @@ namespace boost {
       friend class concurrent_flat_map;
       template <class Key2, class T2, class Hash2, class Pred2,
         class Allocator2>
-      friend class unordered_flat_map;
+      friend class boost::unordered::unordered_flat_map;
 
       using type_policy = detail::foa::flat_map_types<Key, T>;
 
@@ -673,6 +677,23 @@ namespace boost {
         return merge(x);
       }
 
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+      template <class ExecPolicy, class FwdIterator>
+      typename std::enable_if<detail::is_execution_policy<ExecPolicy>::value,
+        size_type>::type
+      merge(ExecPolicy&& p, FwdIterator first, FwdIterator last)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_EXEC_POLICY(ExecPolicy)
+        BOOST_UNORDERED_STATIC_ASSERT_FWD_ITERATOR(FwdIterator)
+
+        std::vector<decltype(&first->table_)> tables;
+        for (; first != last; ++first) {
+          tables.push_back(&first->table_);
+        }
+        return table_.merge(p, tables.data(), tables.data() + tables.size());
+      }
+#endif
+
       BOOST_FORCEINLINE size_type count(key_type const& k) const
       {
         return table_.count(k);
@@ -714,6 +735,80 @@ namespace boost {
       void rehash(size_type n) { table_.rehash(n); }
       void reserve(size_type n) { table_.reserve(n); }
 
+      /// Snapshots
+      ///
+
+      template <class Archive>
+      void save_snapshot(Archive& ar, size_type chunk_size = 0) const
+      {
+        table_.save_snapshot(ar, chunk_size);
+      }
+
+      template <class Archive> void load_snapshot(Archive& ar)
+      {
+        table_.load_snapshot(ar);
+      }
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+      template <class ExecPolicy, class Archive>
+      typename std::enable_if<detail::is_execution_policy<ExecPolicy>::value,
+        void>::type
+      load_snapshot(ExecPolicy&& p, Archive& ar)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_EXEC_POLICY(ExecPolicy)
+        table_.load_snapshot(p, ar);
+      }
+#endif
+
+#if defined(BOOST_UNORDERED_ENABLE_INCREMENTAL_CHECKPOINTS)
+      /// Incremental checkpoints
+      ///
+
+      template <class Archive> void save_delta(Archive& ar) const
+      {
+        table_.save_delta(ar);
+      }
+
+      template <class Archive> void apply_delta(Archive& ar)
+      {
+        table_.apply_delta(ar);
+      }
+#endif
+
+      /// Layout-preserving serialization
+      ///
+
+      template <class Archive> void save_layout(Archive& ar) const
+      {
+        table_.save_layout(ar);
+      }
+
+      template <class Archive> void load_layout(Archive& ar)
+      {
+        table_.load_layout(ar);
+      }
+
+      /// Compact serialization
+      ///
+
+      template <class Archive> void save_compact(Archive& ar) const
+      {
+        std::vector<std::pair<key_type, mapped_type> > entries;
+        entries.reserve(this->size());
+        table_.cvisit_all([&entries](value_type const& x) {
+          entries.emplace_back(x.first, x.second);
+        });
+        detail::save_compact_entries(ar, entries);
+      }
+
+      template <class Archive> void load_compact(Archive& ar)
+      {
+        this->clear();
+        detail::load_compact_entries<key_type, mapped_type>(
+          ar, [this](size_type n) { this->reserve(n); },
+          [this](key_type k, mapped_type m) { table_.emplace(k, m); });
+      }
+
       /// Observers
       ///
       allocator_type get_allocator() const noexcept
@@ -854,6 +949,7 @@ namespace boost {
 
 #endif
 
+    BOOST_UNORDERED_INCREMENTAL_CHECKPOINTS_NAMESPACE_END
   } // namespace unordered
 } // namespace boost
 
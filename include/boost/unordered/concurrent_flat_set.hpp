@@ -16,6 +16,7 @@
 #include <boost/unordered/detail/concurrent_static_asserts.hpp>
 #include <boost/unordered/detail/foa/concurrent_table.hpp>
 #include <boost/unordered/detail/foa/flat_set_types.hpp>
+#include <boost/unordered/detail/serialize_compact.hpp>
 #include <boost/unordered/detail/type_traits.hpp>
 #include <boost/unordered/unordered_flat_set_fwd.hpp>
 
@@ -24,9 +25,12 @@
 #include <boost/core/serialization.hpp>
 
 #include <utility>
+#include <vector>
 
 namespace boost {
   namespace unordered {
+    BOOST_UNORDERED_INCREMENTAL_CHECKPOINTS_NAMESPACE_BEGIN
+
     template <class Key, class Hash, class Pred, class Allocator>
     class concurrent_flat_set
     {
@@ -34,7 +38,7 @@ namespace boost {
       template <class Key2, class Hash2, class Pred2, class Allocator2>
       friend class concurrent_flat_set;
       template <class Key2, class Hash2, class Pred2, class Allocator2>
-      friend class unordered_flat_set;
+      friend class boost::unordered::unordered_flat_set;
 
       using type_policy = detail::foa::flat_set_types<Key>;
 
@@ -541,6 +545,23 @@ namespace boost {
         return merge(x);
       }
 
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+      template <class ExecPolicy, class FwdIterator>
+      typename std::enable_if<detail::is_execution_policy<ExecPolicy>::value,
+        size_type>::type
+      merge(ExecPolicy&& p, FwdIterator first, FwdIterator last)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_EXEC_POLICY(ExecPolicy)
+        BOOST_UNORDERED_STATIC_ASSERT_FWD_ITERATOR(FwdIterator)
+
+        std::vector<decltype(&first->table_)> tables;
+        for (; first != last; ++first) {
+          tables.push_back(&first->table_);
+        }
+        return table_.merge(p, tables.data(), tables.data() + tables.size());
+      }
+#endif
+
       BOOST_FORCEINLINE size_type count(key_type const& k) const
       {
         return table_.count(k);
@@ -582,6 +603,80 @@ namespace boost {
       void rehash(size_type n) { table_.rehash(n); }
       void reserve(size_type n) { table_.reserve(n); }
 
+      /// Snapshots
+      ///
+
+      template <class Archive>
+      void save_snapshot(Archive& ar, size_type chunk_size = 0) const
+      {
+        table_.save_snapshot(ar, chunk_size);
+      }
+
+      template <class Archive> void load_snapshot(Archive& ar)
+      {
+        table_.load_snapshot(ar);
+      }
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+      template <class ExecPolicy, class Archive>
+      typename std::enable_if<detail::is_execution_policy<ExecPolicy>::value,
+        void>::type
+      load_snapshot(ExecPolicy&& p, Archive& ar)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_EXEC_POLICY(ExecPolicy)
+        table_.load_snapshot(p, ar);
+      }
+#endif
+
+#if defined(BOOST_UNORDERED_ENABLE_INCREMENTAL_CHECKPOINTS)
+      /// Incremental checkpoints
+      ///
+
+      template <class Archive> void save_delta(Archive& ar) const
+      {
+        table_.save_delta(ar);
+      }
+
+      template <class Archive> void apply_delta(Archive& ar)
+      {
+        table_.apply_delta(ar);
+      }
+#endif
+
+      /// Layout-preserving serialization
+      ///
+
+      template <class Archive> void save_layout(Archive& ar) const
+      {
+        table_.save_layout(ar);
+      }
+
+      template <class Archive> void load_layout(Archive& ar)
+      {
+        table_.load_layout(ar);
+      }
+
+      /// Compact serialization
+      ///
+
+      template <class Archive> void save_compact(Archive& ar) const
+      {
+        std::vector<std::pair<key_type, detail::compact_no_mapped> > entries;
+        entries.reserve(this->size());
+        table_.cvisit_all([&entries](value_type const& x) {
+          entries.emplace_back(x, detail::compact_no_mapped());
+        });
+        detail::save_compact_entries(ar, entries);
+      }
+
+      template <class Archive> void load_compact(Archive& ar)
+      {
+        this->clear();
+        detail::load_compact_entries<key_type, detail::compact_no_mapped>(
+          ar, [this](size_type n) { this->reserve(n); },
+          [this](key_type k, detail::compact_no_mapped) { table_.emplace(k); });
+      }
+
       /// Observers
       ///
       allocator_type get_allocator() const noexcept
@@ -710,6 +805,7 @@ namespace boost {
 
 #endif
 
+    BOOST_UNORDERED_INCREMENTAL_CHECKPOINTS_NAMESPACE_END
   } // namespace unordered
 } // namespace boost
 
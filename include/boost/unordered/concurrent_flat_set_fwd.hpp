@@ -13,12 +13,14 @@
 #define BOOST_UNORDERED_CONCURRENT_FLAT_SET_FWD_HPP
 
 #include <boost/container_hash/hash_fwd.hpp>
+#include <boost/unordered/detail/incremental_checkpoints.hpp>
 
 #include <functional>
 #include <memory>
 
 namespace boost {
   namespace unordered {
+    BOOST_UNORDERED_INCREMENTAL_CHECKPOINTS_NAMESPACE_BEGIN
 
     template <class Key, class Hash = boost::hash<Key>,
       class Pred = std::equal_to<Key>,
@@ -44,6 +46,7 @@ namespace boost {
     typename concurrent_flat_set<K, H, P, A>::size_type erase_if(
       concurrent_flat_set<K, H, P, A>& c, Predicate pred);
 
+    BOOST_UNORDERED_INCREMENTAL_CHECKPOINTS_NAMESPACE_END
   } // namespace unordered
 
   using boost::unordered::concurrent_flat_set;
@@ -0,0 +1,216 @@
+/* Copyright 2026 agent.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See https://www.boost.org/libs/unordered for library home page.
+ */
+
+#ifndef BOOST_UNORDERED_DETAIL_DOUBLE_BUFFERED_STREAMBUF_HPP
+#define BOOST_UNORDERED_DETAIL_DOUBLE_BUFFERED_STREAMBUF_HPP
+
+#include <boost/config.hpp>
+#include <boost/throw_exception.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <ios>
+#include <mutex>
+#include <streambuf>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace boost{
+namespace unordered{
+namespace detail{
+
+/* Stream buffers decoupling (de)serialization from I/O: a dedicated thread
+ * transfers one buffer from/to the underlying stream buffer while the
+ * other one is being filled (output) or consumed (input) by the caller.
+ */
+
+constexpr std::size_t double_buffer_size=1<<20;
+
+class double_buffered_ostreambuf:public std::streambuf
+{
+public:
+  explicit double_buffered_ostreambuf(
+    std::streambuf& sink_,std::size_t n=double_buffer_size):
+    sink(sink_),front(n),back(n),io{&double_buffered_ostreambuf::run,this}
+  {
+    setp(front.data(),front.data()+front.size());
+  }
+
+  double_buffered_ostreambuf(const double_buffered_ostreambuf&)=delete;
+  double_buffered_ostreambuf& operator=(
+    const double_buffered_ostreambuf&)=delete;
+
+  ~double_buffered_ostreambuf()
+  {
+    {
+      std::lock_guard<std::mutex> lck{mtx};
+      done=true;
+    }
+    cv.notify_all();
+    io.join();
+  }
+
+  /* writes pending data and waits for the I/O thread to finish with it */
+
+  void close()
+  {
+    hand_over();
+    std::unique_lock<std::mutex> lck{mtx};
+    cv.wait(lck,[this]{return !pending;});
+    if(failed||sink.pubsync()!=0){
+      throw_exception(std::ios_base::failure("write failed"));
+    }
+  }
+
+protected:
+  int_type overflow(int_type c)override
+  {
+    hand_over();
+    if(!traits_type::eq_int_type(c,traits_type::eof())){
+      *pptr()=traits_type::to_char_type(c);
+      pbump(1);
+    }
+    return traits_type::not_eof(c);
+  }
+
+private:
+  void hand_over()
+  {
+    std::size_t n=static_cast<std::size_t>(pptr()-pbase());
+    {
+      std::unique_lock<std::mutex> lck{mtx};
+      cv.wait(lck,[this]{return !pending;});
+      if(failed)throw_exception(std::ios_base::failure("write failed"));
+      std::swap(front,back);
+      back_size=n;
+      pending=true;
+    }
+    cv.notify_all();
+    setp(front.data(),front.data()+front.size());
+  }
+
+  void run()
+  {
+    std::unique_lock<std::mutex> lck{mtx};
+    for(;;){
+      cv.wait(lck,[this]{return pending||done;});
+      if(!pending)return;
+      lck.unlock();
+      bool ok=back_size==0||
+        sink.sputn(back.data(),static_cast<std::streamsize>(back_size))==
+          static_cast<std::streamsize>(back_size);
+      lck.lock();
+      if(!ok)failed=true;
+      pending=false;
+      cv.notify_all();
+    }
+  }
+
+  std::streambuf&         sink;
+  std::vector<char>       front,back;
+  std::size_t             back_size=0;
+  bool                    pending=false,done=false,failed=false;
+  std::mutex              mtx;
+  std::condition_variable cv;
+  std::thread             io;
+};
+
+class double_buffered_istreambuf:public std::streambuf
+{
+public:
+  explicit double_buffered_istreambuf(
+    std::streambuf& source_,std::size_t n=double_buffer_size):
+    source(source_),front(n),back(n),
+    io{&double_buffered_istreambuf::run,this}
+  {
+    setg(front.data(),front.data(),front.data());
+  }
+
+  double_buffered_istreambuf(const double_buffered_istreambuf&)=delete;
+  double_buffered_istreambuf& operator=(
+    const double_buffered_istreambuf&)=delete;
+
+  ~double_buffered_istreambuf()
+  {
+    {
+      std::unique_lock<std::mutex> lck{mtx};
+      cv.wait(lck,[this]{return !pending;});
+      done=true;
+    }
+    cv.notify_all();
+    io.join();
+  }
+
+  /* Waits for the I/O thread and gives back the data read ahead if the
+   * underlying stream buffer supports seeking; otherwise it's lost.
+   */
+
+  void close()
+  {
+    std::unique_lock<std::mutex> lck{mtx};
+    cv.wait(lck,[this]{return !pending;});
+    auto n=static_cast<std::streamoff>(egptr()-gptr())+
+           static_cast<std::streamoff>(back_size);
+    if(n!=0)source.pubseekoff(-n,std::ios_base::cur,std::ios_base::in);
+    back_size=0;
+    setg(front.data(),front.data(),front.data());
+  }
+
+protected:
+  int_type underflow()override
+  {
+    if(gptr()<egptr())return traits_type::to_int_type(*gptr());
+
+    std::size_t n;
+    {
+      std::unique_lock<std::mutex> lck{mtx};
+      cv.wait(lck,[this]{return !pending;});
+      if(back_size==0)return traits_type::eof();
+      std::swap(front,back);
+      n=back_size;
+      back_size=0;
+      pending=true;
+    }
+    cv.notify_all();
+    setg(front.data(),front.data(),front.data()+n);
+    return traits_type::to_int_type(*gptr());
+  }
+
+private:
+  void run()
+  {
+    std::unique_lock<std::mutex> lck{mtx};
+    for(;;){
+      if(pending){ /* initially true so as to read the first block */
+        lck.unlock();
+        auto n=source.sgetn(
+          back.data(),static_cast<std::streamsize>(back.size()));
+        lck.lock();
+        back_size=n>0?static_cast<std::size_t>(n):0;
+        pending=false;
+        cv.notify_all();
+      }
+      cv.wait(lck,[this]{return pending||done;});
+      if(done)return;
+    }
+  }
+
+  std::streambuf&         source;
+  std::vector<char>       front,back;
+  std::size_t             back_size=0;
+  bool                    pending=true,done=false;
+  std::mutex              mtx;
+  std::condition_variable cv;
+  std::thread             io;
+};
+
+} /* namespace detail */
+} /* namespace unordered */
+} /* namespace boost */
+
+#endif
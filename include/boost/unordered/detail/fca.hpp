@@ -111,8 +111,22 @@ sentinel to use as the end iterator.
 Otherwise, usage of the data structure is relatively straight-forward compared
 to normal separate chaining implementations.
 
+When BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS is defined, nodes carry two
+additional members so that each run of equivalent elements in a bucket's list
+forms a group: the first node of a group stores the number of elements in the
+group (`group_size`) and a pointer to its last node (`group_last`), whereas the
+rest of the nodes in the group have `group_size == 0`. Containers with unique
+keys simply form groups of size 1. This allows lookups to skip whole groups of
+equivalent elements, makes `count` O(1) once the group is found and lets
+rehashing move each group with a single hash calculation.
+
+```
+bucket -> [A1|3|->A3] -> [A2|0] -> [A3|0] -> [B1|1|->B1] -> null
+```
+
 */
 
+#include <boost/unordered/detail/grouped_keys.hpp>
 #include <boost/unordered/detail/prime_fmod.hpp>
 #include <boost/unordered/detail/serialize_tracked_address.hpp>
 #include <boost/unordered/detail/opt_storage.hpp>
@@ -134,6 +148,9 @@ namespace boost {
   namespace unordered {
     namespace detail {
 
+      // see boost/unordered/detail/grouped_keys.hpp
+      BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_BEGIN
+
       template <class ValueType, class VoidPtr> struct node
       {
         typedef ValueType value_type;
@@ -141,9 +158,17 @@ namespace boost {
           node>::type node_pointer;
 
         node_pointer next;
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+        node_pointer group_last;
+        std::size_t group_size;
+#endif
         opt_storage<value_type> buf;
 
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+        node() noexcept : next(), group_last(), group_size(0), buf() {}
+#else
         node() noexcept : next(), buf() {}
+#endif
 
         value_type* value_ptr() noexcept
         {
@@ -156,6 +181,8 @@ namespace boost {
         }
       };
 
+      BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_END
+
       template <class Node, class VoidPtr> struct bucket
       {
         typedef typename boost::pointer_traits<VoidPtr>::template rebind_to<
@@ -783,19 +810,51 @@ namespace boost {
         {
           this->append_bucket_group(itb);
 
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+          p->group_last = p;
+          p->group_size = 1;
+#endif
           p->next = itb->next;
           itb->next = p;
         }
 
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+        // Links the group starting at p at the front of the bucket
+        void insert_group(iterator itb, node_pointer p) noexcept
+        {
+          this->append_bucket_group(itb);
+
+          p->group_last->next = itb->next;
+          itb->next = p;
+        }
+#endif
+
+        // If BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS is defined, hint
+        // must be null or the first node of a group, in which case p is
+        // appended to the end of the group.
         void insert_node_hint(
           iterator itb, node_pointer p, node_pointer hint) noexcept
         {
           this->append_bucket_group(itb);
 
           if (hint) {
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+            BOOST_ASSERT(hint->group_size > 0);
+            node_pointer last = hint->group_last;
+            p->group_size = 0;
+            p->next = last->next;
+            last->next = p;
+            hint->group_last = p;
+            ++hint->group_size;
+#else
             p->next = hint->next;
             hint->next = p;
+#endif
           } else {
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+            p->group_last = p;
+            p->group_size = 1;
+#endif
             p->next = itb->next;
             itb->next = p;
           }
@@ -804,13 +863,55 @@ namespace boost {
         void extract_node(iterator itb, node_pointer p) noexcept
         {
           node_pointer* pp = std::addressof(itb->next);
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+          node_pointer prev = node_pointer(), head = node_pointer();
+          while ((*pp) != p) {
+            prev = *pp;
+            if (prev->group_size) {
+              head = prev;
+            }
+            pp = std::addressof(prev->next);
+          }
+          unlink_node(pp, prev, head);
+#else
           while ((*pp) != p)
             pp = std::addressof((*pp)->next);
           *pp = p->next;
+#endif
           if (!itb->next)
             unlink_bucket(itb);
         }
 
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+        // Unlinks *pp, where prev is the node preceding *pp in the bucket (or
+        // null if *pp is the first node) and head is the first node of the
+        // group *pp belongs to. On return, head is updated to the first node
+        // of the group the new *pp belongs to if it's the same group, or null
+        // otherwise.
+        static void unlink_node(
+          node_pointer* pp, node_pointer prev, node_pointer& head) noexcept
+        {
+          node_pointer p = *pp;
+          if (p->group_size) {
+            if (p->group_size > 1) {
+              node_pointer n = p->next;
+              n->group_last = p->group_last;
+              n->group_size = p->group_size - 1;
+              head = n;
+            } else {
+              head = node_pointer();
+            }
+          } else {
+            BOOST_ASSERT(head && prev);
+            --head->group_size;
+            if (head->group_last == p) {
+              head->group_last = prev;
+            }
+          }
+          *pp = p->next;
+        }
+#endif
+
         void extract_node_after(iterator itb, node_pointer* pp) noexcept
         {
           *pp = (*pp)->next;
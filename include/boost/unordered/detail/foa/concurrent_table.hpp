@@ -14,6 +14,7 @@
 #include <atomic>
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
+#include <boost/core/bit.hpp>
 #include <boost/core/ignore_unused.hpp>
 #include <boost/core/no_exceptions_support.hpp>
 #include <boost/core/serialization.hpp>
@@ -26,17 +27,21 @@
 #include <boost/unordered/detail/foa/reentrancy_check.hpp>
 #include <boost/unordered/detail/foa/rw_spinlock.hpp>
 #include <boost/unordered/detail/foa/tuple_rotate_right.hpp>
+#include <boost/unordered/detail/incremental_checkpoints.hpp>
 #include <boost/unordered/detail/serialization_version.hpp>
 #include <boost/unordered/detail/static_assert.hpp>
+#include <climits>
 #include <cstddef>
 #include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <type_traits>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #if !defined(BOOST_UNORDERED_DISABLE_PARALLEL_ALGORITHMS)
 #if defined(BOOST_UNORDERED_ENABLE_PARALLEL_ALGORITHMS)|| \
@@ -72,6 +77,11 @@ using is_execution_policy=std::false_type;
 
 namespace foa{
 
+template<typename,typename,typename,typename>
+class table; /* concurrent/non-concurrent interop */
+
+BOOST_UNORDERED_INCREMENTAL_CHECKPOINTS_NAMESPACE_BEGIN
+
 static constexpr std::size_t cacheline_size=64;
 
 template<typename T,std::size_t N>
@@ -213,16 +223,45 @@ struct atomic_integral
 
 /* Group-level concurrency protection. It provides a rw mutex plus an
  * atomic insertion counter for optimistic insertion (see
- * unprotected_norehash_emplace_or_visit).
+ * unprotected_norehash_emplace_or_visit). With incremental checkpoints
+ * enabled, exclusive access also sets a dirty flag (see
+ * concurrent_table::save_delta): groups start out dirty, as they're new to
+ * any previous checkpoint.
  */
 
 struct group_access
 {    
   using mutex_type=rw_spinlock;
   using shared_lock_guard=shared_lock<mutex_type>;
-  using exclusive_lock_guard=lock_guard<mutex_type>;
   using insert_counter_type=std::atomic<boost::uint32_t>;
 
+#if defined(BOOST_UNORDERED_ENABLE_INCREMENTAL_CHECKPOINTS)
+  struct exclusive_lock_guard:lock_guard<mutex_type>
+  {
+    exclusive_lock_guard(mutex_type& m_,std::atomic<bool>& dirty_)noexcept:
+      lock_guard<mutex_type>{m_}
+    {
+      /* set after locking so that save_delta can't miss the change */
+      dirty_.store(true,std::memory_order_relaxed);
+    }
+  };
+
+  shared_lock_guard    shared_access(){return shared_lock_guard{m};}
+  exclusive_lock_guard exclusive_access(){return {m,dirty};}
+  insert_counter_type& insert_counter(){return cnt;}
+
+  void mark_dirty(){dirty.store(true,std::memory_order_relaxed);}
+
+  /* atomic exchange so as to see the latest exclusive access */
+  bool reset_dirty(){return dirty.exchange(false,std::memory_order_relaxed);}
+
+private:
+  mutex_type          m;
+  insert_counter_type cnt{0};
+  std::atomic<bool>   dirty{true};
+#else
+  using exclusive_lock_guard=lock_guard<mutex_type>;
+
   shared_lock_guard    shared_access(){return shared_lock_guard{m};}
   exclusive_lock_guard exclusive_access(){return exclusive_lock_guard{m};}
   insert_counter_type& insert_counter(){return cnt;}
@@ -230,6 +269,7 @@ struct group_access
 private:
   mutex_type          m;
   insert_counter_type cnt{0};
+#endif
 };
 
 template<std::size_t Size>
@@ -259,12 +299,19 @@ struct concurrent_table_arrays:table_arrays<Value,Group,SizePolicy,Allocator>
   using super=table_arrays<Value,Group,SizePolicy,Allocator>;
 
   concurrent_table_arrays(const super& arrays,group_access_pointer pga):
-    super{arrays},group_accesses_{pga}{}
+    super{arrays},group_accesses_{pga},generation_{++generation_counter}{}
 
   group_access* group_accesses()const noexcept{
     return boost::to_address(group_accesses_);
   }
 
+  /* Distinct for every set of arrays created (on rehashing or otherwise),
+   * so that replacement of the arrays can be detected even if new ones are
+   * allocated at the same address as the old.
+   */
+
+  boost::uint64_t generation()const noexcept{return generation_;}
+
   static concurrent_table_arrays new_(
     group_access_allocator_type al,std::size_t n)
   {
@@ -336,9 +383,16 @@ struct concurrent_table_arrays:table_arrays<Value,Group,SizePolicy,Allocator>
     }
   }
 
+  static std::atomic<boost::uint64_t> generation_counter;
+
   group_access_pointer group_accesses_;
+  boost::uint64_t      generation_;
 };
 
+template<typename V,typename G,typename S,typename A>
+std::atomic<boost::uint64_t>
+concurrent_table_arrays<V,G,S,A>::generation_counter={};
+
 struct atomic_size_control
 {
   static constexpr auto atomic_size_t_size=sizeof(std::atomic<std::size_t>);
@@ -428,9 +482,6 @@ inline void swap(atomic_size_control& x,atomic_size_control& y)
  *       start over.
  */
 
-template<typename,typename,typename,typename>
-class table; /* concurrent/non-concurrent interop */
-
 template <typename TypePolicy,typename Hash,typename Pred,typename Allocator>
 using concurrent_table_core_impl=table_core<
   TypePolicy,group15<atomic_integral>,concurrent_table_arrays,
@@ -454,6 +505,7 @@ class concurrent_table:
   using prober=typename super::prober;
   using arrays_type=typename super::arrays_type;
   using size_ctrl_type=typename super::size_ctrl_type;
+  using locator=typename super::locator;
   using compatible_nonconcurrent_table=table<TypePolicy,Hash,Pred,Allocator>;
   friend compatible_nonconcurrent_table;
 
@@ -506,6 +558,11 @@ public:
           x.arrays.elements_});},
       size_ctrl_type{x.size_ctrl.ml,x.size_ctrl.size}}
   {
+    /* interleaved layouts not supported */
+    BOOST_UNORDERED_STATIC_ASSERT(
+      compatible_nonconcurrent_table::group_stride==1);
+
+    x.delete_key_array();
     x.arrays=ah.release();
     x.size_ctrl.ml=x.initial_max_load();
     x.size_ctrl.size=0;
@@ -521,6 +578,7 @@ public:
   {
     auto lck=exclusive_access(*this,x);
     super::operator=(x);
+    invalidate_delta();
     return *this;
   }
 
@@ -529,12 +587,15 @@ public:
   {
     auto lck=exclusive_access(*this,x);
     super::operator=(std::move(x));
+    invalidate_delta();
+    x.invalidate_delta();
     return *this;
   }
 
   concurrent_table& operator=(std::initializer_list<value_type> il) {
     auto lck=exclusive_access();
     super::clear();
+    invalidate_delta();
     super::noshrink_reserve(il.size());
     for (auto const& v : il) {
       this->unprotected_emplace(v);
@@ -855,12 +916,15 @@ public:
   {
     auto lck=exclusive_access(*this,x);
     super::swap(x);
+    invalidate_delta();
+    x.invalidate_delta();
   }
 
   void clear()noexcept
   {
     auto lck=exclusive_access();
     super::clear();
+    invalidate_delta();
   }
 
   // TODO: should we accept different allocator too?
@@ -875,6 +939,22 @@ public:
 
     auto      lck=exclusive_access(*this,x);
     size_type s=super::size();
+    invalidate_delta();
+    x.invalidate_delta();
+    if(s==0&&std::is_same<Pred,Pred2>::value&&
+       super::template transfer_layout_compatible<Hash2>(
+         x.arrays,x.super2::size())){
+      /* no duplicates can arise, so skip lookup and hash recalculation */
+      super::import_overflow(x.arrays);
+      x.super2::for_all_elements(
+        [&,this](group_type* pg,unsigned int n,element_type* p){
+          typename merge_table_type::erase_on_exit e{x,pg,n,p};
+          (void)e;
+          super::unchecked_transfer(x.arrays,pg,n,p);
+        });
+      return size_type{super::size()};
+    }
+
     x.super2::for_all_elements( /* super2::for_all_elements -> unprotected */
       [&,this](group_type* pg,unsigned int n,element_type* p){
         typename merge_table_type::erase_on_exit e{x,pg,n,p};
@@ -886,6 +966,105 @@ public:
   template<typename Hash2,typename Pred2>
   void merge(concurrent_table<TypePolicy,Hash2,Pred2,Allocator>&& x){merge(x);}
 
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+  /* Parallel merge of a range of non-concurrent tables (reduce step of
+   * per-thread aggregation): source elements are hashed in parallel (one
+   * task per source) and bucketed by the most significant bits of their
+   * initial position in *this, then each bucket is inserted by one task
+   * into what's mostly a disjoint range of groups, thus keeping group lock
+   * contention low. Inserted elements are erased from their sources in a
+   * final parallel pass. Exceptions thrown during the process result in
+   * std::terminate, as with the rest of parallel algorithms.
+   */
+
+  template<typename ExecutionPolicy,typename Hash2,typename Pred2>
+  size_type merge(
+    ExecutionPolicy&& policy,
+    table<TypePolicy,Hash2,Pred2,Allocator>* const* first,
+    table<TypePolicy,Hash2,Pred2,Allocator>* const* last)
+  {
+    using merge_table_type=table<TypePolicy,Hash2,Pred2,Allocator>;
+    using super2=typename merge_table_type::super;
+    using group_type2=typename merge_table_type::group_type;
+
+    struct entry
+    {
+      std::size_t  hash;
+      group_type2  *pg;
+      unsigned int n;
+      element_type *p;
+      bool         inserted;
+    };
+    using bucket_type=std::vector<entry>;
+    using partition_type=std::vector<bucket_type>; /* one bucket per source */
+
+    // for clang
+    boost::ignore_unused<super2>();
+
+    auto        num_sources=static_cast<std::size_t>(last-first);
+    std::size_t num_groups;
+    std::size_t groups_size_index;
+    {
+      std::size_t n=0;
+      for(auto it=first;it!=last;++it)n+=(*it)->size();
+
+      auto lck=exclusive_access();
+      if(super::size()+n>this->size_ctrl.ml)super::reserve(super::size()+n);
+      num_groups=this->arrays.groups_size_mask+1;
+      groups_size_index=this->arrays.groups_size_index;
+    }
+
+    static constexpr std::size_t max_partitions=256;
+    auto num_partitions=
+      num_groups<max_partitions?num_groups:max_partitions;
+    auto groups_per_partition=num_groups/num_partitions;
+
+    /* parallel algorithms may pass copies of the elements of the sequence,
+     * so source indices are iterated over rather than [first,last)
+     */
+
+    std::vector<std::size_t> sources(num_sources);
+    for(std::size_t s=0;s<num_sources;++s)sources[s]=s;
+
+    std::vector<partition_type> partitions(
+      num_partitions,partition_type(num_sources));
+    std::for_each(policy,sources.begin(),sources.end(),[&,this](std::size_t s){
+      auto x=first[s];
+      auto lck=shared_access();
+      x->super2::for_all_elements(
+        [&,this](group_type2* pg,unsigned int n,element_type* p){
+          auto hash=this->hash_for(this->key_from(*p));
+          auto pos=super::size_policy::position(hash,groups_size_index);
+          partitions[pos/groups_per_partition][s].push_back(
+            {hash,pg,n,p,false});
+        });
+    });
+
+    std::atomic<size_type> res{0};
+    std::for_each(policy,partitions.begin(),partitions.end(),
+      [&,this](partition_type& partition){
+        size_type m=0;
+        for(auto& bucket:partition){
+          for(auto& e:bucket){
+            e.inserted=emplace_with_hash(e.hash,type_policy::move(*e.p));
+            m+=e.inserted;
+          }
+        }
+        res+=m;
+      });
+
+    std::for_each(policy,sources.begin(),sources.end(),[&](std::size_t s){
+      auto x=first[s];
+      for(auto& partition:partitions){
+        for(auto& e:partition[s]){
+          if(e.inserted)x->super2::erase(e.pg,e.n,e.p);
+        }
+      }
+    });
+    return res;
+  }
+#endif
+
   hasher hash_function()const
   {
     auto lck=shared_access();
@@ -944,6 +1123,111 @@ public:
     super::reserve(n);
   }
 
+  /* Fuzzy snapshot: elements are saved group by group, each under its own
+   * shared lock, so concurrent operations proceed while saving (archive
+   * writing included). The result needn't reflect any single state of the
+   * container, but all elements present for the whole duration of the save
+   * are included, possibly some more than once. With chunk_size==0 the
+   * container-level shared lock is held throughout, which only blocks
+   * rehashing; otherwise, it's released every ~chunk_size slots, and the
+   * walk starts over if a rehash took place in between.
+   * Format: versions, size at the start of saving, then (count,elements)
+   * for each non-empty group, terminated by a zero count.
+   */
+
+  template<typename Archive>
+  void save_snapshot(Archive& ar,std::size_t chunk_size)const
+  {
+    save_snapshot(
+      ar,chunk_size,
+      std::integral_constant<bool,std::is_same<key_type,value_type>::value>{});
+  }
+
+  template<typename Archive>
+  void load_snapshot(Archive& ar)
+  {
+    load_snapshot(
+      ar,
+      std::integral_constant<bool,std::is_same<key_type,value_type>::value>{});
+  }
+
+  template<typename Archive>
+  void save_layout(Archive& ar)const
+  {
+    save_layout(
+      ar,
+      std::integral_constant<bool,std::is_same<key_type,value_type>::value>{});
+  }
+
+  template<typename Archive>
+  void load_layout(Archive& ar)
+  {
+    load_layout(
+      ar,
+      std::integral_constant<bool,std::is_same<key_type,value_type>::value>{});
+  }
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+  /* Parallel load of a snapshot: decoding the archive is inherently
+   * sequential, so blocks are read in batches of around
+   * snapshot_batch_size elements and each batch is then hashed and inserted
+   * with std::for_each(policy,...) over partitions of contiguous groups, so
+   * that group lock contention is low and duplicate elements are resolved
+   * as in sequential loading (see load_snapshot_batch). Loaded objects are
+   * moved twice, so their addresses are not reported to the archive for
+   * object tracking.
+   */
+
+  template<typename ExecutionPolicy,typename Archive>
+  auto load_snapshot(ExecutionPolicy&& policy,Archive& ar)->
+    typename std::enable_if<
+      is_execution_policy<ExecutionPolicy>::value,void>::type
+  {
+    load_snapshot(
+      policy,ar,
+      std::integral_constant<bool,std::is_same<key_type,value_type>::value>{});
+  }
+#endif
+
+#if defined(BOOST_UNORDERED_ENABLE_INCREMENTAL_CHECKPOINTS)
+  /* Incremental checkpointing (only with
+   * BOOST_UNORDERED_ENABLE_INCREMENTAL_CHECKPOINTS): save_delta saves only
+   * the groups with their dirty flag set (see group_access), that is, those
+   * exclusively accessed (by insertion, erasure, exclusive visitation or
+   * insertion probing) since the previous call, and resets their flags.
+   * As with snapshots, each group is saved under its own shared lock with
+   * the container-level shared lock held throughout, so concurrent
+   * operations other than rehashing proceed; concurrent save_delta calls
+   * are serialized through delta_mutex, as each resets the flags the others
+   * rely on. Operations rewriting the table wholesale set delta_full, as
+   * does a change of arrays (detected by their generation) since the last
+   * delta: all non-empty groups are saved then, and the receiving table is
+   * cleared and given the same capacity. apply_delta replaces the contents
+   * of the saved groups slot by slot (overflow bits are recomputed from the
+   * probe paths of the elements), which is meaningful only if the receiving
+   * table has been kept in sync by applying all previous deltas.
+   * Format: versions, hash fingerprint, full flag, groups size index, max
+   * load, then for each saved group its position, count and
+   * (slot,hash,element) entries, terminated by the number of groups.
+   */
+
+  template<typename Archive>
+  void save_delta(Archive& ar)const
+  {
+    save_delta(
+      ar,
+      std::integral_constant<bool,std::is_same<key_type,value_type>::value>{});
+  }
+
+  template<typename Archive>
+  void apply_delta(Archive& ar)
+  {
+    apply_delta(
+      ar,
+      std::integral_constant<bool,std::is_same<key_type,value_type>::value>{});
+  }
+#endif
+
   template<typename Predicate>
   friend std::size_t erase_if(concurrent_table& x,Predicate&& pr)
   {
@@ -1177,7 +1461,8 @@ private:
         do{
           auto n=unchecked_countr_zero(mask);
           if(BOOST_LIKELY(
-            pg->is_occupied(n)&&bool(this->pred()(x,this->key_from(p[n]))))){
+            pg->is_occupied(n)&&
+            bool(this->pred()(lookup_key(x),this->key_from(p[n]))))){
             f(pg,n,p+n);
             return 1;
           }
@@ -1204,13 +1489,13 @@ private:
     int         masks[2*bulk_visit_size-1];
     auto        it=first;
 
-    for(auto i=m;i--;++it){
-      auto hash=hashes[i]=this->hash_for(*it);
-      auto pos=positions[i]=this->position_for(hash);
+    this->hash_for_batch(first,m,hashes);
+    for(std::size_t i=0;i<m;++i){
+      auto pos=positions[i]=this->position_for(hashes[i]);
       BOOST_UNORDERED_PREFETCH(this->arrays.groups()+pos);
     }
 
-    for(auto i=m;i--;){
+    for(std::size_t i=0;i<m;++i){
       auto hash=hashes[i];
       auto pos=positions[i];
       auto mask=masks[i]=(this->arrays.groups()+pos)->match(hash);
@@ -1221,8 +1506,7 @@ private:
       }
     }
 
-    it=first;
-    for(auto i=m;i--;++it){
+    for(std::size_t i=0;i<m;++i,++it){
       auto          pos=positions[i];
       prober        pb(pos);
       auto          pg=this->arrays.groups()+pos;
@@ -1237,7 +1521,7 @@ private:
             auto n=unchecked_countr_zero(mask);
             if(BOOST_LIKELY(
               pg->is_occupied(n)&&
-              bool(this->pred()(*it,this->key_from(p[n]))))){
+              bool(this->pred()(lookup_key(*it),this->key_from(p[n]))))){
               f(cast_for(access_mode,type_policy::value_from(p[n])));
               ++res;
               goto next_key;
@@ -1362,6 +1646,29 @@ private:
     );
   }
 
+  template<typename... Args>
+  BOOST_FORCEINLINE bool emplace_with_hash(std::size_t hash,Args&&... args)
+  {
+    return emplace_or_visit_with_hash(
+      hash,group_shared{},[](const value_type&){},
+      std::forward<Args>(args)...);
+  }
+
+  template<typename GroupAccessMode,typename F,typename... Args>
+  BOOST_FORCEINLINE bool emplace_or_visit_with_hash(
+    std::size_t hash,GroupAccessMode access_mode,F&& f,Args&&... args)
+  {
+    for(;;){
+      {
+        auto lck=shared_access();
+        int res=unprotected_norehash_hashed_emplace_or_visit(
+          hash,access_mode,std::forward<F>(f),std::forward<Args>(args)...);
+        if(BOOST_LIKELY(res>=0))return res!=0;
+      }
+      rehash_if_full();
+    }
+  }
+
   template<typename GroupAccessMode,typename F,typename... Args>
   BOOST_FORCEINLINE bool emplace_or_visit_impl(
     GroupAccessMode access_mode,F&& f,Args&&... args)
@@ -1442,7 +1749,17 @@ private:
     GroupAccessMode access_mode,F&& f,Args&&... args)
   {
     const auto &k=this->key_from(std::forward<Args>(args)...);
-    auto        hash=this->hash_for(k);
+    return unprotected_norehash_hashed_emplace_or_visit(
+      this->hash_for(k),access_mode,std::forward<F>(f),
+      std::forward<Args>(args)...);
+  }
+
+  template<typename GroupAccessMode,typename F,typename... Args>
+  BOOST_FORCEINLINE int
+  unprotected_norehash_hashed_emplace_or_visit(
+    std::size_t hash,GroupAccessMode access_mode,F&& f,Args&&... args)
+  {
+    const auto &k=this->key_from(std::forward<Args>(args)...);
     auto        pos0=this->position_for(hash);
 
     for(;;){
@@ -1618,7 +1935,7 @@ private:
     super::for_all_elements([&,this](element_type* p){
       auto& x=type_policy::value_from(*p);
       core::save_construct_data_adl(ar,std::addressof(x),value_version);
-      ar<<serialization::make_nvp("item",x);
+      ar<<core::make_nvp("item",x);
     });
   }
 
@@ -1648,10 +1965,10 @@ private:
       auto& x=type_policy::value_from(*p);
       core::save_construct_data_adl(
         ar,std::addressof(x.first),key_version);
-      ar<<serialization::make_nvp("key",x.first);
+      ar<<core::make_nvp("key",x.first);
       core::save_construct_data_adl(
         ar,std::addressof(x.second),mapped_version);
-      ar<<serialization::make_nvp("mapped",x.second);
+      ar<<core::make_nvp("mapped",x.second);
     });
   }
 
@@ -1674,6 +1991,7 @@ private:
     ar>>core::make_nvp("value_version",value_version);
 
     super::clear();
+    invalidate_delta();
     super::reserve(s);
 
     for(std::size_t n=0;n<s;++n){
@@ -1705,6 +2023,7 @@ private:
     ar>>core::make_nvp("mapped_version",mapped_version);
 
     super::clear();
+    invalidate_delta();
     super::reserve(s);
 
     for(std::size_t n=0;n<s;++n){
@@ -1722,8 +2041,694 @@ private:
     }
   }
 
-  static std::atomic<std::size_t> thread_counter;
-  mutable multimutex_type         mutexes;
+  template<typename Archive>
+  void save_layout(Archive& ar,std::true_type /* set */)const
+  {
+    auto                                    lck=exclusive_access();
+    const serialization_version<value_type> value_version;
+
+    ar<<core::make_nvp("value_version",value_version);
+
+    super::save_layout(ar,[&](group_type*,unsigned int,element_type* p){
+      auto& x=type_policy::value_from(*p);
+      core::save_construct_data_adl(ar,std::addressof(x),value_version);
+      ar<<core::make_nvp("item",x);
+    });
+  }
+
+  template<typename Archive>
+  void save_layout(Archive& ar,std::false_type /* map */)const
+  {
+    using raw_key_type=typename std::remove_const<key_type>::type;
+    using raw_mapped_type=typename std::remove_const<
+      typename TypePolicy::mapped_type>::type;
+
+    auto                                         lck=exclusive_access();
+    const serialization_version<raw_key_type>    key_version;
+    const serialization_version<raw_mapped_type> mapped_version;
+
+    ar<<core::make_nvp("key_version",key_version);
+    ar<<core::make_nvp("mapped_version",mapped_version);
+
+    super::save_layout(ar,[&](group_type*,unsigned int,element_type* p){
+      auto& x=type_policy::value_from(*p);
+      core::save_construct_data_adl(
+        ar,std::addressof(x.first),key_version);
+      ar<<core::make_nvp("key",x.first);
+      core::save_construct_data_adl(
+        ar,std::addressof(x.second),mapped_version);
+      ar<<core::make_nvp("mapped",x.second);
+    });
+  }
+
+  template<typename Archive>
+  void load_layout(Archive& ar,std::true_type /* set */)
+  {
+    auto                              lck=exclusive_access();
+    serialization_version<value_type> value_version;
+
+    ar>>core::make_nvp("value_version",value_version);
+
+    bool direct,check;
+    auto s=super::load_layout_arrays(ar,direct,check);
+    invalidate_delta();
+    for(std::size_t n=0;n<s;++n){
+      std::size_t slot,hash;
+      ar>>core::make_nvp("slot",slot);
+      ar>>core::make_nvp("hash",hash);
+
+      archive_constructed<value_type> value("item",ar,value_version);
+      auto&                           x=value.get();
+      auto                            loc=this->unchecked_emplace_from_layout(
+        slot,hash,direct,
+        super::layout_check_for(check,n),
+        x,std::move(x));
+      ar.reset_object_address(std::addressof(*loc.p),std::addressof(x));
+    }
+  }
+
+  template<typename Archive>
+  void load_layout(Archive& ar,std::false_type /* map */)
+  {
+    using raw_key_type=typename std::remove_const<key_type>::type;
+    using raw_mapped_type=typename std::remove_const<
+      typename TypePolicy::mapped_type>::type;
+
+    auto                                   lck=exclusive_access();
+    serialization_version<raw_key_type>    key_version;
+    serialization_version<raw_mapped_type> mapped_version;
+
+    ar>>core::make_nvp("key_version",key_version);
+    ar>>core::make_nvp("mapped_version",mapped_version);
+
+    bool direct,check;
+    auto s=super::load_layout_arrays(ar,direct,check);
+    invalidate_delta();
+    for(std::size_t n=0;n<s;++n){
+      std::size_t slot,hash;
+      ar>>core::make_nvp("slot",slot);
+      ar>>core::make_nvp("hash",hash);
+
+      archive_constructed<raw_key_type>    key("key",ar,key_version);
+      archive_constructed<raw_mapped_type> mapped("mapped",ar,mapped_version);
+      auto&                                k=key.get();
+      auto&                                m=mapped.get();
+      auto                                 loc=
+        this->unchecked_emplace_from_layout(
+          slot,hash,direct,
+          super::layout_check_for(check,n),
+          k,std::move(k),std::move(m));
+      ar.reset_object_address(std::addressof(loc.p->first),std::addressof(k));
+      ar.reset_object_address(std::addressof(loc.p->second),std::addressof(m));
+    }
+  }
+
+  template<typename Archive>
+  void save_snapshot(
+    Archive& ar,std::size_t chunk_size,std::true_type /* set */)const
+  {
+    const serialization_version<value_type> value_version;
+
+    ar<<core::make_nvp("value_version",value_version);
+
+    save_snapshot_groups(ar,chunk_size,[&,this](element_type* p){
+      auto& x=type_policy::value_from(*p);
+      core::save_construct_data_adl(ar,std::addressof(x),value_version);
+      ar<<core::make_nvp("item",x);
+    });
+  }
+
+  template<typename Archive>
+  void save_snapshot(
+    Archive& ar,std::size_t chunk_size,std::false_type /* map */)const
+  {
+    using raw_key_type=typename std::remove_const<key_type>::type;
+    using raw_mapped_type=typename std::remove_const<
+      typename TypePolicy::mapped_type>::type;
+
+    const serialization_version<raw_key_type>    key_version;
+    const serialization_version<raw_mapped_type> mapped_version;
+
+    ar<<core::make_nvp("key_version",key_version);
+    ar<<core::make_nvp("mapped_version",mapped_version);
+
+    save_snapshot_groups(ar,chunk_size,[&,this](element_type* p){
+      auto& x=type_policy::value_from(*p);
+      core::save_construct_data_adl(
+        ar,std::addressof(x.first),key_version);
+      ar<<core::make_nvp("key",x.first);
+      core::save_construct_data_adl(
+        ar,std::addressof(x.second),mapped_version);
+      ar<<core::make_nvp("mapped",x.second);
+    });
+  }
+
+  template<typename Archive,typename F>
+  void save_snapshot_groups(Archive& ar,std::size_t chunk_size,F f)const
+  {
+    /* elements are saved in table order, and inserting them in this order
+     * into a growing table produces long clusters: the size at the start
+     * of saving is recorded so that loading can reserve up front
+     */
+    const std::size_t size_hint=super::size();
+    ar<<core::make_nvp("size_hint",size_hint);
+
+    if(chunk_size==0){
+      auto lck=shared_access();
+      save_snapshot_groups(ar,0,this->arrays.groups_size_mask+1,f);
+    }
+    else{
+      std::size_t     groups_per_chunk=(chunk_size+N-1)/N;
+      boost::uint64_t generation=0; /* never that of actual arrays */
+      std::size_t     pos=0;
+      for(;;){
+        auto lck=shared_access();
+        auto groups_size=this->arrays.groups_size_mask+1;
+        if(this->arrays.generation()!=generation){ /* first chunk or rehash */
+          generation=this->arrays.generation();
+          pos=0;
+        }
+        auto last=groups_size-pos>groups_per_chunk?
+          pos+groups_per_chunk:groups_size;
+        save_snapshot_groups(ar,pos,last,f);
+        if((pos=last)==groups_size)break;
+      }
+    }
+
+    const std::size_t zero=0;
+    ar<<core::make_nvp("count",zero);
+  }
+
+  template<typename Archive,typename F>
+  void save_snapshot_groups(
+    Archive& ar,std::size_t first,std::size_t last,F& f)const
+  {
+    if(!this->arrays.elements())return;
+
+    auto pg0=this->arrays.groups(),
+         pgl=pg0+this->arrays.groups_size_mask+1;
+    for(auto pos=first;pos<last;++pos){
+      auto lck=access(group_shared{},pos);
+      auto pg=pg0+pos;
+      auto mask=this->match_really_occupied(pg,pgl);
+      if(!mask)continue;
+
+      const std::size_t s=static_cast<std::size_t>(
+        boost::core::popcount(static_cast<unsigned int>(mask)));
+      ar<<core::make_nvp("count",s);
+
+      auto p=this->arrays.elements()+pos*N;
+      do{
+        f(p+unchecked_countr_zero(mask));
+        mask&=mask-1;
+      }while(mask);
+    }
+  }
+
+  template<typename Archive>
+  void load_snapshot(Archive& ar,std::true_type /* set */)
+  {
+    auto                              lck=exclusive_access();
+    serialization_version<value_type> value_version;
+
+    ar>>core::make_nvp("value_version",value_version);
+
+    std::size_t size_hint;
+    ar>>core::make_nvp("size_hint",size_hint);
+
+    super::clear();
+    super::reserve(size_hint);
+    invalidate_delta();
+
+    for(;;){
+      std::size_t s;
+      ar>>core::make_nvp("count",s);
+      if(!s)break;
+
+      for(std::size_t n=0;n<s;++n){
+        archive_constructed<value_type> value("item",ar,value_version);
+        auto&                           x=value.get();
+        auto                            hash=this->hash_for(x);
+        auto                            pos0=this->position_for(hash);
+
+        auto loc=this->find(x,pos0,hash);
+        if(!loc)loc=unchecked_emplace_for_load(pos0,hash,std::move(x));
+        ar.reset_object_address(std::addressof(*loc.p),std::addressof(x));
+      }
+    }
+  }
+
+  template<typename Archive>
+  void load_snapshot(Archive& ar,std::false_type /* map */)
+  {
+    using raw_key_type=typename std::remove_const<key_type>::type;
+    using raw_mapped_type=typename std::remove_const<
+      typename TypePolicy::mapped_type>::type;
+
+    auto                                   lck=exclusive_access();
+    serialization_version<raw_key_type>    key_version;
+    serialization_version<raw_mapped_type> mapped_version;
+
+    ar>>core::make_nvp("key_version",key_version);
+    ar>>core::make_nvp("mapped_version",mapped_version);
+
+    std::size_t size_hint;
+    ar>>core::make_nvp("size_hint",size_hint);
+
+    super::clear();
+    super::reserve(size_hint);
+    invalidate_delta();
+
+    for(;;){
+      std::size_t s;
+      ar>>core::make_nvp("count",s);
+      if(!s)break;
+
+      for(std::size_t n=0;n<s;++n){
+        archive_constructed<raw_key_type>    key("key",ar,key_version);
+        archive_constructed<raw_mapped_type> mapped(
+                                               "mapped",ar,mapped_version);
+        auto&                                k=key.get();
+        auto&                                m=mapped.get();
+        auto                                 hash=this->hash_for(k);
+        auto                                 pos0=this->position_for(hash);
+
+        /* elements saved more than once: the last copy is the most recent */
+        auto loc=this->find(k,pos0,hash);
+        if(loc)loc.p->second=std::move(m);
+        else   loc=unchecked_emplace_for_load(
+                 pos0,hash,std::move(k),std::move(m));
+        ar.reset_object_address(std::addressof(loc.p->first),std::addressof(k));
+        ar.reset_object_address(std::addressof(loc.p->second),std::addressof(m));
+      }
+    }
+  }
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+  static constexpr std::size_t snapshot_batch_size=16384;
+
+  template<typename ExecutionPolicy,typename Archive>
+  void load_snapshot(
+    ExecutionPolicy& policy,Archive& ar,std::true_type /* set */)
+  {
+    serialization_version<value_type> value_version;
+
+    ar>>core::make_nvp("value_version",value_version);
+
+    std::size_t size_hint;
+    ar>>core::make_nvp("size_hint",size_hint);
+
+    clear();
+    reserve(size_hint);
+
+    std::vector<init_type> batch;
+    for(bool more=true;more;){
+      batch.clear();
+      while(batch.size()<snapshot_batch_size){
+        std::size_t s;
+        ar>>core::make_nvp("count",s);
+        if(!s){
+          more=false;
+          break;
+        }
+
+        for(std::size_t n=0;n<s;++n){
+          archive_constructed<value_type> value("item",ar,value_version);
+          batch.push_back(std::move(value.get()));
+        }
+      }
+
+      /* elements saved more than once: the first copy is kept, as in
+       * sequential loading
+       */
+      load_snapshot_batch(
+        policy,batch,[this](std::size_t hash,init_type& x){
+          emplace_with_hash(hash,type_policy::move(x));
+        });
+    }
+  }
+
+  template<typename ExecutionPolicy,typename Archive>
+  void load_snapshot(
+    ExecutionPolicy& policy,Archive& ar,std::false_type /* map */)
+  {
+    using raw_key_type=typename std::remove_const<key_type>::type;
+    using raw_mapped_type=typename std::remove_const<
+      typename TypePolicy::mapped_type>::type;
+
+    serialization_version<raw_key_type>    key_version;
+    serialization_version<raw_mapped_type> mapped_version;
+
+    ar>>core::make_nvp("key_version",key_version);
+    ar>>core::make_nvp("mapped_version",mapped_version);
+
+    std::size_t size_hint;
+    ar>>core::make_nvp("size_hint",size_hint);
+
+    clear();
+    reserve(size_hint);
+
+    std::vector<init_type> batch;
+    for(bool more=true;more;){
+      batch.clear();
+      while(batch.size()<snapshot_batch_size){
+        std::size_t s;
+        ar>>core::make_nvp("count",s);
+        if(!s){
+          more=false;
+          break;
+        }
+
+        for(std::size_t n=0;n<s;++n){
+          archive_constructed<raw_key_type>    key("key",ar,key_version);
+          archive_constructed<raw_mapped_type> mapped(
+                                                 "mapped",ar,mapped_version);
+          batch.emplace_back(std::move(key.get()),std::move(mapped.get()));
+        }
+      }
+
+      /* elements saved more than once: the last copy is the most recent,
+       * as in sequential loading
+       */
+      load_snapshot_batch(
+        policy,batch,[this](std::size_t hash,init_type& x){
+          emplace_or_visit_with_hash(
+            hash,group_exclusive{},
+            [&](value_type& v){v.second=std::move(x.second);},
+            type_policy::move(x));
+        });
+    }
+  }
+
+  /* Copies of an element saved more than once must be processed in archive
+   * order for the result to match that of sequential loading. As they have
+   * the same initial probe position, the batch is split into partitions
+   * covering contiguous ranges of groups (as done in merge) and each
+   * partition is processed sequentially.
+   */
+
+  template<typename ExecutionPolicy,typename F>
+  void load_snapshot_batch(
+    ExecutionPolicy& policy,std::vector<init_type>& batch,F f)
+  {
+    if(batch.empty())return;
+
+    std::size_t num_groups;
+    std::size_t groups_size_index;
+    {
+      auto lck=exclusive_access();
+      auto n=super::size()+batch.size();
+      if(n>this->size_ctrl.ml)super::reserve(n);
+      num_groups=this->arrays.groups_size_mask+1;
+      groups_size_index=this->arrays.groups_size_index;
+    }
+
+    static constexpr std::size_t max_partitions=256;
+    auto num_partitions=
+      num_groups<max_partitions?num_groups:max_partitions;
+    auto groups_per_partition=num_groups/num_partitions;
+
+    /* batch indices rather than elements are iterated over, as parallel
+     * algorithms may pass copies of the elements of the sequence
+     */
+
+    std::vector<std::size_t> indices(batch.size()),hashes(batch.size());
+    for(std::size_t i=0;i<batch.size();++i)indices[i]=i;
+    std::for_each(policy,indices.begin(),indices.end(),[&,this](std::size_t i){
+      hashes[i]=this->hash_for(type_policy::extract(batch[i]));
+    });
+
+    std::vector<std::vector<std::size_t>> partitions(num_partitions);
+    for(std::size_t i=0;i<batch.size();++i){
+      auto pos=super::size_policy::position(hashes[i],groups_size_index);
+      partitions[pos/groups_per_partition].push_back(i);
+    }
+
+    std::for_each(policy,partitions.begin(),partitions.end(),
+      [&](const std::vector<std::size_t>& partition){
+        for(auto i:partition)f(hashes[i],batch[i]);
+      });
+  }
+#endif
+
+  template<typename... Args>
+  locator unchecked_emplace_for_load(
+    std::size_t pos0,std::size_t hash,Args&&... args)
+  {
+    if(this->size_ctrl.size<this->size_ctrl.ml){
+      return this->unchecked_emplace_at(pos0,hash,std::forward<Args>(args)...);
+    }
+    else{
+      return this->unchecked_emplace_with_rehash(
+        hash,std::forward<Args>(args)...);
+    }
+  }
+
+#if defined(BOOST_UNORDERED_ENABLE_INCREMENTAL_CHECKPOINTS)
+  void invalidate_delta()const{delta_full=true;}
+
+  template<typename Archive>
+  void save_delta(Archive& ar,std::true_type /* set */)const
+  {
+    const serialization_version<value_type> value_version;
+
+    ar<<core::make_nvp("value_version",value_version);
+
+    save_delta_groups(ar,[&,this](element_type* p){
+      auto& x=type_policy::value_from(*p);
+      core::save_construct_data_adl(ar,std::addressof(x),value_version);
+      ar<<core::make_nvp("item",x);
+    });
+  }
+
+  template<typename Archive>
+  void save_delta(Archive& ar,std::false_type /* map */)const
+  {
+    using raw_key_type=typename std::remove_const<key_type>::type;
+    using raw_mapped_type=typename std::remove_const<
+      typename TypePolicy::mapped_type>::type;
+
+    const serialization_version<raw_key_type>    key_version;
+    const serialization_version<raw_mapped_type> mapped_version;
+
+    ar<<core::make_nvp("key_version",key_version);
+    ar<<core::make_nvp("mapped_version",mapped_version);
+
+    save_delta_groups(ar,[&,this](element_type* p){
+      auto& x=type_policy::value_from(*p);
+      core::save_construct_data_adl(
+        ar,std::addressof(x.first),key_version);
+      ar<<core::make_nvp("key",x.first);
+      core::save_construct_data_adl(
+        ar,std::addressof(x.second),mapped_version);
+      ar<<core::make_nvp("mapped",x.second);
+    });
+  }
+
+  template<typename Archive,typename F>
+  void save_delta_groups(Archive& ar,F f)const
+  {
+    /* dirty flags and delta state are shared by all callers */
+    std::lock_guard<std::mutex> dlck{delta_mutex};
+
+    auto              lck=shared_access();
+    auto              pg0=this->arrays.groups();
+    const auto        generation=this->arrays.generation();
+    const bool        rehashed=
+                        delta_generation.exchange(generation)!=generation,
+                      full=delta_full.exchange(false)||rehashed;
+    const std::size_t gsi=
+                        this->arrays.elements()?
+                        this->arrays.groups_size_index:0,
+                      groups_size=gsi?this->arrays.groups_size_mask+1:0,
+                      ml=this->size_ctrl.ml;
+
+    super::save_hash_fingerprint(ar);
+    ar<<core::make_nvp("full",full);
+    ar<<core::make_nvp("groups_size_index",gsi);
+    ar<<core::make_nvp("max_load",ml);
+
+    auto pgl=pg0+groups_size;
+    for(std::size_t pos=0;pos<groups_size;++pos){
+      if(!this->arrays.group_accesses()[pos].reset_dirty()&&!full)continue;
+
+      auto lck2=access(group_shared{},pos);
+      auto mask=this->match_really_occupied(pg0+pos,pgl);
+      if(full&&!mask)continue;
+
+      const std::size_t s=static_cast<std::size_t>(
+        boost::core::popcount(static_cast<unsigned int>(mask)));
+      ar<<core::make_nvp("group",pos);
+      ar<<core::make_nvp("count",s);
+
+      auto p=this->arrays.elements()+pos*N;
+      for(;mask;mask&=mask-1){
+        const std::size_t n=static_cast<std::size_t>(
+                            unchecked_countr_zero(mask)),
+                          hash=this->hash_for(this->key_from(p[n]));
+
+        ar<<core::make_nvp("slot",n);
+        ar<<core::make_nvp("hash",hash);
+        f(p+n);
+      }
+    }
+    ar<<core::make_nvp("group",groups_size);
+  }
+
+  template<typename Archive>
+  void apply_delta(Archive& ar,std::true_type /* set */)
+  {
+    auto                              lck=exclusive_access();
+    serialization_version<value_type> value_version;
+
+    ar>>core::make_nvp("value_version",value_version);
+
+    apply_delta_groups(
+      ar,[&,this](std::size_t slot,std::size_t hash,bool check){
+      archive_constructed<value_type> value("item",ar,value_version);
+      auto&                           x=value.get();
+      auto                            loc=emplace_from_delta(
+                                          slot,hash,check,x,std::move(x));
+      ar.reset_object_address(std::addressof(*loc.p),std::addressof(x));
+    });
+  }
+
+  template<typename Archive>
+  void apply_delta(Archive& ar,std::false_type /* map */)
+  {
+    using raw_key_type=typename std::remove_const<key_type>::type;
+    using raw_mapped_type=typename std::remove_const<
+      typename TypePolicy::mapped_type>::type;
+
+    auto                                   lck=exclusive_access();
+    serialization_version<raw_key_type>    key_version;
+    serialization_version<raw_mapped_type> mapped_version;
+
+    ar>>core::make_nvp("key_version",key_version);
+    ar>>core::make_nvp("mapped_version",mapped_version);
+
+    apply_delta_groups(
+      ar,[&,this](std::size_t slot,std::size_t hash,bool check){
+      archive_constructed<raw_key_type>    key("key",ar,key_version);
+      archive_constructed<raw_mapped_type> mapped("mapped",ar,mapped_version);
+      auto&                                k=key.get();
+      auto&                                m=mapped.get();
+      auto                                 loc=emplace_from_delta(
+                                             slot,hash,check,k,std::move(k),
+                                             std::move(m));
+      ar.reset_object_address(std::addressof(loc.p->first),std::addressof(k));
+      ar.reset_object_address(std::addressof(loc.p->second),std::addressof(m));
+    });
+  }
+
+  template<typename Archive,typename F>
+  void apply_delta_groups(Archive& ar,F f)
+  {
+    bool        full;
+    std::size_t gsi,ml;
+
+    /* elements are placed at their original slot, so the hash function
+     * must be the same: with equal fingerprints, hash values need not be
+     * checked
+     */
+    auto match=super::load_hash_fingerprint(ar);
+    if(match==hash_fingerprint_match::different){
+      throw_exception(bad_archive_exception());
+    }
+    const bool check=match==hash_fingerprint_match::unknown;
+
+    ar>>core::make_nvp("full",full);
+    ar>>core::make_nvp("groups_size_index",gsi);
+    ar>>core::make_nvp("max_load",ml);
+    if(gsi>=sizeof(std::size_t)*CHAR_BIT){
+      throw_exception(bad_archive_exception());
+    }
+
+    if(full){
+      super::clear_for_layout(gsi);
+      delta_full=true;
+    }
+    else if(gsi!=0&&
+            (!this->arrays.elements()||
+             this->arrays.groups_size_index!=gsi)){
+      /* not the table the previous deltas were applied to */
+      throw_exception(bad_archive_exception());
+    }
+
+    const std::size_t groups_size=gsi?this->arrays.groups_size_mask+1:0;
+    auto              pg0=this->arrays.groups(),
+                      pgl=pg0+groups_size;
+
+    /* lifted during application as intermediate states of fuzzy deltas
+     * can have more elements than the source ever had
+     */
+    this->size_ctrl.ml=super::capacity();
+    BOOST_TRY{
+      for(;;){
+        std::size_t pos,s;
+        ar>>core::make_nvp("group",pos);
+        if(pos==groups_size)break;
+        ar>>core::make_nvp("count",s);
+        if(pos>groups_size||s>N)throw_exception(bad_archive_exception());
+
+        auto pg=pg0+pos;
+        auto p=this->arrays.elements()+pos*N;
+        for(auto mask=this->match_really_occupied(pg,pgl);mask;
+            mask&=mask-1){
+          auto n=unchecked_countr_zero(mask);
+          this->destroy_element(p+n);
+          pg->reset(n);
+          --this->size_ctrl.size;
+        }
+        this->arrays.group_accesses()[pos].mark_dirty();
+
+        for(std::size_t i=0;i<s;++i){
+          std::size_t n,hash;
+          ar>>core::make_nvp("slot",n);
+          ar>>core::make_nvp("hash",hash);
+          if(n>=N)throw_exception(bad_archive_exception());
+          f(pos*N+n,hash,check);
+        }
+      }
+    }
+    BOOST_CATCH(...){
+      this->size_ctrl.ml=adjusted_delta_max_load(ml);
+      BOOST_RETHROW
+    }
+    BOOST_CATCH_END
+    this->size_ctrl.ml=adjusted_delta_max_load(ml);
+  }
+
+  template<typename Key,typename... Args>
+  locator emplace_from_delta(
+    std::size_t slot,std::size_t hash,bool check,const Key& x,Args&&... args)
+  {
+    if(check&&this->hash_for(x)!=hash){
+      throw_exception(bad_archive_exception());
+    }
+
+    bool direct=true;
+    return this->unchecked_emplace_from_layout(
+      slot,hash,direct,false,x,std::forward<Args>(args)...);
+  }
+
+  std::size_t adjusted_delta_max_load(std::size_t ml)const
+  {
+    std::size_t s=this->size_ctrl.size;
+    if(ml>this->initial_max_load())ml=this->initial_max_load();
+    return ml<s?s:ml;
+  }
+#else
+  void invalidate_delta()const{}
+#endif
+
+  static std::atomic<std::size_t>      thread_counter;
+  mutable multimutex_type              mutexes;
+#if defined(BOOST_UNORDERED_ENABLE_INCREMENTAL_CHECKPOINTS)
+  mutable std::mutex                   delta_mutex;
+  mutable std::atomic<bool>            delta_full{true};
+  mutable std::atomic<boost::uint64_t> delta_generation{0};
+#endif
 };
 
 template<typename T,typename H,typename P,typename A>
@@ -1735,6 +2740,8 @@ std::atomic<std::size_t> concurrent_table<T,H,P,A>::thread_counter={};
 
 #include <boost/unordered/detail/foa/restore_wshadow.hpp>
 
+BOOST_UNORDERED_INCREMENTAL_CHECKPOINTS_NAMESPACE_END
+
 } /* namespace foa */
 } /* namespace detail */
 } /* namespace unordered */
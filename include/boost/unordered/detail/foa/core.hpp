@@ -20,17 +20,22 @@
 #include <boost/core/empty_value.hpp>
 #include <boost/core/no_exceptions_support.hpp>
 #include <boost/core/pointer_traits.hpp>
+#include <boost/core/serialization.hpp>
 #include <boost/cstdint.hpp>
 #include <boost/predef.h>
+#include <boost/throw_exception.hpp>
+#include <boost/unordered/detail/bad_archive_exception.hpp>
 #include <boost/unordered/detail/narrow_cast.hpp>
 #include <boost/unordered/detail/mulx.hpp>
 #include <boost/unordered/detail/static_assert.hpp>
 #include <boost/unordered/detail/type_traits.hpp>
+#include <boost/unordered/detail/xmx.hpp>
 #include <boost/unordered/hash_traits.hpp>
 #include <climits>
 #include <cmath>
 #include <cstddef>
 #include <cstring>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <new>
@@ -38,6 +43,10 @@
 #include <type_traits>
 #include <utility>
 
+#if defined(BOOST_UNORDERED_ENABLE_HASH_QUALITY_MONITOR)
+#include <boost/unordered/hash_quality.hpp>
+#endif
+
 #if !defined(BOOST_UNORDERED_DISABLE_SSE2)
 #if defined(BOOST_UNORDERED_ENABLE_SSE2)|| \
     defined(__SSE2__)|| \
@@ -198,6 +207,11 @@ static constexpr std::size_t default_bucket_count=0;
  * the first 64-bit word contain the least significant bits of each byte in the
  * "logical" 128-bit word, and so forth. With this layout, match can be
  * implemented with 4 ANDs, 3 shifts, 2 XORs, 1 OR and 1 NOT.
+ *
+ * set(pos,x,xpos) and mark_overflow(x) copy a reduced hash value and the
+ * overflow bits from another group, respectively. They're used to transfer
+ * elements between tables with the same layout without recalculating hash
+ * values (see table_core::unchecked_transfer).
  * 
  * IntegralWrapper<Integral> is used to implement group15's underlying
  * metadata: it behaves as a plain integral for foa::table or introduces
@@ -232,6 +246,12 @@ struct group15
     at(pos)=reduced_hash(hash);
   }
 
+  inline void set(std::size_t pos,const group15& x,std::size_t xpos)
+  {
+    BOOST_ASSERT(pos<N&&xpos<N);
+    at(pos)=static_cast<unsigned char>(x.at(xpos));
+  }
+
   inline void set_sentinel()
   {
     at(N-1)=sentinel_;
@@ -277,6 +297,11 @@ struct group15
     overflow()|=static_cast<unsigned char>(1<<(hash%8));
   }
 
+  inline void mark_overflow(const group15& x)
+  {
+    overflow()|=static_cast<unsigned char>(x.overflow());
+  }
+
   static inline bool maybe_caused_overflow(unsigned char* pc)
   {
     std::size_t pos=reinterpret_cast<uintptr_t>(pc)%sizeof(group15);
@@ -434,6 +459,12 @@ struct group15
     at(pos)=reduced_hash(hash);
   }
 
+  inline void set(std::size_t pos,const group15& x,std::size_t xpos)
+  {
+    BOOST_ASSERT(pos<N&&xpos<N);
+    at(pos)=static_cast<unsigned char>(x.at(xpos));
+  }
+
   inline void set_sentinel()
   {
     at(N-1)=sentinel_;
@@ -479,6 +510,11 @@ struct group15
     overflow()|=static_cast<unsigned char>(1<<(hash%8));
   }
 
+  inline void mark_overflow(const group15& x)
+  {
+    overflow()|=static_cast<unsigned char>(x.overflow());
+  }
+
   static inline bool maybe_caused_overflow(unsigned char* pc)
   {
     std::size_t pos=reinterpret_cast<uintptr_t>(pc)%sizeof(group15);
@@ -627,6 +663,12 @@ struct group15
     set_impl(pos,reduced_hash(hash));
   }
 
+  inline void set(std::size_t pos,const group15& x,std::size_t xpos)
+  {
+    BOOST_ASSERT(pos<N&&xpos<N);
+    set_impl(pos,x.get_impl(xpos));
+  }
+
   inline void set_sentinel()
   {
     set_impl(N-1,sentinel_);
@@ -670,6 +712,14 @@ struct group15
     reinterpret_cast<boost::uint16_t*>(m)[hash%8]|=0x8000u;
   }
 
+  inline void mark_overflow(const group15& x)
+  {
+    static constexpr boost::uint64_t overflow_bits=0x8000800080008000ull;
+
+    m[0]|=boost::uint64_t(x.m[0])&overflow_bits;
+    m[1]|=boost::uint64_t(x.m[1])&overflow_bits;
+  }
+
   static inline bool maybe_caused_overflow(unsigned char* pc)
   {
     std::size_t     pos=reinterpret_cast<uintptr_t>(pc)%sizeof(group15);
@@ -740,6 +790,17 @@ private:
     set_impl(m[1],pos,n>>4);
   }
 
+  inline std::size_t get_impl(std::size_t pos)const
+  {
+    return get_impl(m[0],pos)|(get_impl(m[1],pos)<<4);
+  }
+
+  static inline std::size_t get_impl(boost::uint64_t x,std::size_t pos)
+  {
+    x>>=pos;
+    return std::size_t((x&1u)|((x>>15)&2u)|((x>>30)&4u)|((x>>45)&8u));
+  }
+
   static inline void set_impl(word_type& x,std::size_t pos,std::size_t n)
   {
     static constexpr boost::uint64_t mask[]=
@@ -879,32 +940,126 @@ private:
   std::size_t pos,step=0;
 };
 
-/* Mixing policies: no_mix is the identity function, and mulx_mix
- * uses the mulx function from <boost/unordered/detail/mulx.hpp>.
+/* Mixing policies: no_mix is the identity function, mulx_mix
+ * uses the mulx function from <boost/unordered/detail/mulx.hpp>, mulx32_mix
+ * its mulx_narrow variant for hash values with up to 32 significant bits,
+ * xmx_mix the xmx function from <boost/unordered/detail/xmx.hpp> and
+ * seeded_mulx_mix the mulx_seeded variant with the seed of the hash object.
+ * mix_hash is applied to an already calculated hash value (see
+ * table_core::hash_for_batch). fingerprint is combined with that of the
+ * hash function so that archives keeping hash values detect a change of
+ * mixing.
  *
- * foa::table_core mixes hash results with mulx_mix unless the hash is marked
- * as avalanching, i.e. of good quality
- * (see <boost/unordered/hash_traits.hpp>).
+ * foa::table_core mixes hash results with the policy selected by
+ * hash_mixing_policy unless the hash is marked as avalanching, i.e. of good
+ * quality (see <boost/unordered/hash_traits.hpp>). Seeded mixing is applied
+ * to avalanching hashes as well, as their results are no less predictable.
  */
 
 struct no_mix
 {
+  static constexpr boost::uint64_t fingerprint=0;
+
   template<typename Hash,typename T>
   static inline std::size_t mix(const Hash& h,const T& x)
   {
-    return h(x);
+    return lookup_hash(h,x);
+  }
+
+  template<typename Hash>
+  static inline std::size_t mix_hash(const Hash&,std::size_t hash)
+  {
+    return hash;
   }
 };
 
 struct mulx_mix
 {
+  static constexpr boost::uint64_t fingerprint=0;
+
   template<typename Hash,typename T>
   static inline std::size_t mix(const Hash& h,const T& x)
   {
-    return mulx(h(x));
+    return mulx(lookup_hash(h,x));
+  }
+
+  template<typename Hash>
+  static inline std::size_t mix_hash(const Hash&,std::size_t hash)
+  {
+    return mulx(hash);
   }
 };
 
+struct mulx32_mix
+{
+  static constexpr boost::uint64_t fingerprint=0x6d756c783332ull;
+
+  template<typename Hash,typename T>
+  static inline std::size_t mix(const Hash& h,const T& x)
+  {
+    return mulx_narrow(lookup_hash(h,x));
+  }
+
+  template<typename Hash>
+  static inline std::size_t mix_hash(const Hash&,std::size_t hash)
+  {
+    return mulx_narrow(hash);
+  }
+};
+
+struct xmx_mix
+{
+  static constexpr boost::uint64_t fingerprint=0x786d78ull;
+
+  template<typename Hash,typename T>
+  static inline std::size_t mix(const Hash& h,const T& x)
+  {
+    return xmx(lookup_hash(h,x));
+  }
+
+  template<typename Hash>
+  static inline std::size_t mix_hash(const Hash&,std::size_t hash)
+  {
+    return xmx(hash);
+  }
+};
+
+struct seeded_mulx_mix
+{
+  static constexpr boost::uint64_t fingerprint=0x7365656465640000ull;
+
+  template<typename Hash,typename T>
+  static inline std::size_t mix(const Hash& h,const T& x)
+  {
+    return mulx_seeded(lookup_hash(h,x),h.seed());
+  }
+
+  template<typename Hash>
+  static inline std::size_t mix_hash(const Hash& h,std::size_t hash)
+  {
+    return mulx_seeded(hash,h.seed());
+  }
+};
+
+template<typename Hash>
+using mix_policy_for=typename std::conditional<
+  hash_mixing_policy<Hash>::value==hash_mixing::seeded_mulx,
+  seeded_mulx_mix,
+  typename std::conditional<
+    hash_is_avalanching<Hash>::value,
+    no_mix,
+    typename std::conditional<
+      hash_mixing_policy<Hash>::value==hash_mixing::mulx32,
+      mulx32_mix,
+      typename std::conditional<
+        hash_mixing_policy<Hash>::value==hash_mixing::xmx,
+        xmx_mix,
+        mulx_mix
+      >::type
+    >::type
+  >::type
+>::type;
+
 /* boost::core::countr_zero has a potentially costly check for
  * the case x==0.
  */
@@ -977,6 +1132,8 @@ struct arrays_holder
 
   ~arrays_holder(){if(!released_)arrays_.delete_(al_,arrays_);}
 
+  const Arrays& get()const{return arrays_;}
+
   const Arrays& release()
   {
     released_=true;
@@ -1005,6 +1162,14 @@ struct table_arrays
       rebind<group_type>;
   using group_type_pointer_traits=boost::pointer_traits<group_type_pointer>;
 
+  /* distance between consecutive groups, in group_type units, and between
+   * the first slots of consecutive groups, in value_type units (see
+   * interleaved_table_arrays)
+   */
+
+  static constexpr std::size_t group_stride=1;
+  static constexpr std::size_t element_stride=N;
+
   table_arrays(
     std::size_t gsi,std::size_t gsm,
     group_type_pointer pg,value_type_pointer pe):
@@ -1118,6 +1283,299 @@ struct table_arrays
   value_type_pointer elements_;
 };
 
+/* split_table_arrays adds to table_arrays a dense array with a copy of the
+ * key of each element, at the same index as the element. Lookup compares
+ * candidate keys there and touches the elements array only on a hit, so
+ * large mapped values are not brought into cache by tag collisions and
+ * unsuccessful lookups. Value is std::pair<const Key,T>; keys must be
+ * trivially copyable as they are written with plain assignment and never
+ * destroyed. The key array is not allocated when elements() is null.
+ */
+
+template<typename Value,typename Group,typename SizePolicy,typename Allocator>
+struct split_table_arrays:table_arrays<Value,Group,SizePolicy,Allocator>
+{
+  using super=table_arrays<Value,Group,SizePolicy,Allocator>;
+  using key_type=typename std::remove_const<typename Value::first_type>::type;
+  using key_allocator_type=
+    typename boost::allocator_rebind<Allocator,key_type>::type;
+  using key_type_pointer=
+    typename boost::allocator_pointer<key_allocator_type>::type;
+
+  BOOST_UNORDERED_STATIC_ASSERT(
+    is_trivially_copy_constructible<key_type>::value&&
+    std::is_trivially_destructible<key_type>::value);
+
+  split_table_arrays(
+    std::size_t gsi,std::size_t gsm,
+    typename super::group_type_pointer pg,
+    typename super::value_type_pointer pe):
+    super{gsi,gsm,pg,pe},keys_{nullptr}{}
+  split_table_arrays(const super& arrays,key_type_pointer pk):
+    super{arrays},keys_{pk}{}
+
+  key_type* keys()const noexcept{return boost::to_address(keys_);}
+
+  static split_table_arrays new_(key_allocator_type al,std::size_t n)
+  {
+    split_table_arrays arrays{super::new_(al,n),nullptr};
+    BOOST_TRY{
+      set_keys(al,arrays);
+    }
+    BOOST_CATCH(...){
+      super::delete_(al,arrays);
+      BOOST_RETHROW
+    }
+    BOOST_CATCH_END
+    return arrays;
+  }
+
+  static void set_keys(key_allocator_type al,split_table_arrays& arrays)
+  {
+    if(arrays.elements()&&!arrays.keys()){
+      arrays.keys_=boost::allocator_allocate(
+        al,(arrays.groups_size_mask+1)*super::N);
+    }
+  }
+
+  static void delete_(key_allocator_type al,split_table_arrays& arrays)noexcept
+  {
+    delete_keys(al,arrays);
+    super::delete_(al,arrays);
+  }
+
+  static void delete_keys(
+    key_allocator_type al,split_table_arrays& arrays)noexcept
+  {
+    if(arrays.keys()){
+      boost::allocator_deallocate(
+        al,arrays.keys_,(arrays.groups_size_mask+1)*super::N);
+      arrays.keys_=nullptr;
+    }
+  }
+
+  key_type_pointer keys_;
+};
+
+template<typename Arrays>
+struct is_split_table_arrays:std::false_type{};
+
+template<typename Value,typename Group,typename SizePolicy,typename Allocator>
+struct is_split_table_arrays<
+  split_table_arrays<Value,Group,SizePolicy,Allocator> >:std::true_type{};
+
+template<std::size_t A,std::size_t B>
+struct static_gcd:static_gcd<B,A%B>{};
+
+template<std::size_t A>
+struct static_gcd<A,0>:std::integral_constant<std::size_t,A>{};
+
+/* interleaved_table_arrays places the metadata of each group immediately
+ * followed by its element slots, so that for small elements a lookup
+ * succeeding at its first probe touches one or two adjacent cache lines
+ * rather than two distant ones. Each group+slots block is padded to a
+ * multiple of both sizeof(group_type) (as table_iterator requires groups to
+ * be aligned to their size) and sizeof(value_type), so that groups and
+ * slots can still be reached by plain pointer arithmetic with strides
+ * group_stride and element_stride, respectively.
+ */
+
+template<typename Value,typename Group,typename SizePolicy,typename Allocator>
+struct interleaved_table_arrays:table_arrays<Value,Group,SizePolicy,Allocator>
+{
+  using super=table_arrays<Value,Group,SizePolicy,Allocator>;
+  using allocator_type=typename super::allocator_type;
+  using value_type=typename super::value_type;
+  using group_type=typename super::group_type;
+  using size_policy=typename super::size_policy;
+  using value_type_pointer=typename super::value_type_pointer;
+  using group_type_pointer=typename super::group_type_pointer;
+  using group_type_pointer_traits=typename super::group_type_pointer_traits;
+  using value_type_pointer_traits=boost::pointer_traits<value_type_pointer>;
+  static constexpr auto N=super::N;
+
+  BOOST_UNORDERED_STATIC_ASSERT(alignof(value_type)<=sizeof(group_type));
+
+  static constexpr std::size_t block_unit=
+    sizeof(group_type)/
+    static_gcd<sizeof(group_type),sizeof(value_type)>::value*
+    sizeof(value_type);
+  static constexpr std::size_t block_size=
+    (sizeof(group_type)+N*sizeof(value_type)+block_unit-1)/
+    block_unit*block_unit;
+  static constexpr std::size_t group_stride=block_size/sizeof(group_type);
+  static constexpr std::size_t element_stride=block_size/sizeof(value_type);
+
+  interleaved_table_arrays(
+    std::size_t gsi,std::size_t gsm,
+    group_type_pointer pg,value_type_pointer pe):
+    super{gsi,gsm,pg,pe},buffer_{nullptr}{}
+
+  static void set_arrays(
+    interleaved_table_arrays& arrays,allocator_type al,std::size_t n)
+  {
+    return set_arrays(
+      arrays,al,n,std::is_same<group_type*,group_type_pointer>{});
+  }
+
+  static void set_arrays(
+    interleaved_table_arrays& arrays,allocator_type al,std::size_t,
+    std::false_type /* always allocate */)
+  {
+    using storage_traits=boost::allocator_traits<allocator_type>;
+    auto groups_size_index=arrays.groups_size_index;
+    auto groups_size=size_policy::size(groups_size_index);
+
+    auto sal=allocator_type(al);
+    arrays.buffer_=storage_traits::allocate(sal,buffer_size(groups_size));
+
+    /* align the first group to sizeof(group_type), slots follow */
+
+    auto p=reinterpret_cast<unsigned char*>(boost::to_address(arrays.buffer_));
+    p+=(uintptr_t(sizeof(group_type))-
+        reinterpret_cast<uintptr_t>(p))%sizeof(group_type);
+    arrays.groups_=
+      group_type_pointer_traits::pointer_to(*reinterpret_cast<group_type*>(p));
+    arrays.elements_=value_type_pointer_traits::pointer_to(
+      *reinterpret_cast<value_type*>(p+sizeof(group_type)));
+
+    auto pg=arrays.groups();
+    for(std::size_t i=0;i<groups_size;++i){
+      super::initialize_groups(
+        pg+i*group_stride,1,is_trivially_default_constructible<group_type>{});
+    }
+    pg[(groups_size-1)*group_stride].set_sentinel();
+  }
+
+  static void set_arrays(
+    interleaved_table_arrays& arrays,allocator_type al,std::size_t n,
+    std::true_type /* optimize for n==0*/)
+  {
+    if(!n){
+      arrays.groups_=
+        dummy_groups<group_type,size_policy::min_size()*group_stride>();
+    }
+    else{
+      set_arrays(arrays,al,n,std::false_type{});
+    }
+  }
+
+  static interleaved_table_arrays new_(allocator_type al,std::size_t n)
+  {
+    auto groups_size_index=size_index_for<group_type,size_policy>(n);
+    auto groups_size=size_policy::size(groups_size_index);
+    interleaved_table_arrays arrays{
+      groups_size_index,groups_size-1,nullptr,nullptr};
+
+    set_arrays(arrays,al,n);
+    return arrays;
+  }
+
+  static void delete_(
+    allocator_type al,interleaved_table_arrays& arrays)noexcept
+  {
+    using storage_traits=boost::allocator_traits<allocator_type>;
+
+    auto sal=allocator_type(al);
+    if(arrays.elements()){
+      storage_traits::deallocate(
+        sal,arrays.buffer_,buffer_size(arrays.groups_size_mask+1));
+    }
+  }
+
+  /* space for groups + slots + padding for alignment measured in
+   * sizeof(value_type)s
+   */
+
+  static std::size_t buffer_size(std::size_t groups_size)
+  {
+    auto buffer_bytes=block_size*groups_size+sizeof(group_type)-1;
+    return (buffer_bytes+sizeof(value_type)-1)/sizeof(value_type);
+  }
+
+  value_type_pointer buffer_;
+};
+
+/* Header of the raw binary image of a table (see table_core::save_image).
+ * Data is stored in native representation, so images are only meant to be
+ * loaded on the same platform: magic number, metadata encoding (one byte
+ * per slot with SIMD, bit-interleaved 64-bit words otherwise, see group15),
+ * byte order and element and group sizes catch the most obvious mismatches.
+ * The header size is a multiple of 16 so that the group array following it
+ * is as aligned as the header.
+ */
+
+struct table_image_header
+{
+  /* "BUFOAIM2" read as a little-endian 64-bit integer */
+  static constexpr boost::uint64_t magic_number(){return 0x324d49414f465542ull;}
+
+  static constexpr boost::uint32_t metadata_encoding_for(bool regular_layout)
+  {
+    return regular_layout?1:2;
+  }
+
+  static constexpr boost::uint32_t native_byte_order()
+  {
+    return BOOST_ENDIAN_BIG_BYTE?2:1;
+  }
+
+  /* the sampled hash digest combines the hash values of the first (up to)
+   * digest_sample_size() elements in layout order; not to be confused with
+   * the hash fingerprint of the hash function itself
+   */
+
+  static constexpr std::size_t digest_sample_size(){return 16;}
+
+  static boost::uint64_t combine_digest(
+    boost::uint64_t fp,std::size_t hash)
+  {
+    return (fp^static_cast<boost::uint64_t>(hash))*0x9E3779B97F4A7C15ull;
+  }
+
+  template<typename Group,typename Element>
+  void set_format()
+  {
+    magic=magic_number();
+    element_size=sizeof(Element);
+    group_size=sizeof(Group);
+    metadata_encoding=metadata_encoding_for(Group::regular_layout);
+    byte_order=native_byte_order();
+    reserved=0;
+  }
+
+  template<typename Group,typename Element>
+  bool has_format()const
+  {
+    return
+      magic==magic_number()&&
+      element_size==sizeof(Element)&&
+      group_size==sizeof(Group)&&
+      metadata_encoding==metadata_encoding_for(Group::regular_layout)&&
+      byte_order==native_byte_order();
+  }
+
+  boost::uint64_t magic;
+  boost::uint32_t element_size;
+  boost::uint32_t group_size;
+  boost::uint32_t metadata_encoding;
+  boost::uint32_t byte_order;
+  boost::uint64_t size;
+  boost::uint64_t ml;
+  boost::uint64_t groups_size_index; /* 0 if no arrays are allocated */
+  boost::uint64_t sampled_hash_digest;
+  boost::uint64_t reserved;
+};
+
+BOOST_UNORDERED_STATIC_ASSERT(sizeof(table_image_header)%16==0);
+
+/* Result of comparing the hash fingerprint (see
+ * <boost/unordered/hash_traits.hpp>) recorded in an archive with that of the
+ * loading hash function: unknown if either of them doesn't provide one.
+ */
+
+enum class hash_fingerprint_match{unknown,equal,different};
+
 struct if_constexpr_void_else{void operator()()const{}};
 
 template<bool B,typename F,typename G=if_constexpr_void_else>
@@ -1321,14 +1779,14 @@ public:
   static constexpr auto N=group_type::N;
   using size_policy=pow2_size_policy;
   using prober=pow2_quadratic_prober;
-  using mix_policy=typename std::conditional<
-    hash_is_avalanching<Hash>::value,
-    no_mix,
-    mulx_mix
-  >::type;
+  using mix_policy=mix_policy_for<Hash>;
+  static constexpr bool cheap_hash=hash_is_cheap<Hash>::value;
   using alloc_traits=boost::allocator_traits<Allocator>;
   using element_type=typename type_policy::element_type;
   using arrays_type=Arrays<element_type,group_type,size_policy,Allocator>;
+  static constexpr bool split_keys=is_split_table_arrays<arrays_type>::value;
+  static constexpr std::size_t group_stride=arrays_type::group_stride;
+  static constexpr std::size_t element_stride=arrays_type::element_stride;
   using size_ctrl_type=SizeControl;
   static constexpr auto uses_fancy_pointers=!std::is_same<
     typename alloc_traits::pointer,
@@ -1590,23 +2048,41 @@ public:
 #pragma warning(disable:4800)
 #endif
 
+  /* Candidates (elements whose reduced hash matches) are compared one at a
+   * time, stopping at the first hit. Comparing all candidates of a group at
+   * once, be it by SIMD loads of the keys or by accumulating comparison
+   * results into a bitmask, has been measured to be slower even for scalar
+   * keys: with a reasonable hash there is ~1 candidate per group, and
+   * touching the whole element block costs more than the branch saved.
+   * This holds as well for the contiguous keys of split_table_arrays and
+   * with frequent reduced hash collisions (benchmark/candidate_compare.cpp).
+   */
+
   template<typename Key>
   BOOST_FORCEINLINE locator find(
     const Key& x,std::size_t pos0,std::size_t hash)const
+  {
+    return find(x,pos0,hash,std::integral_constant<bool,split_keys>{});
+  }
+
+  template<typename Key>
+  BOOST_FORCEINLINE locator find(
+    const Key& x,std::size_t pos0,std::size_t hash,
+    std::false_type /* keys in elements */)const
   {    
     prober pb(pos0);
     do{
       auto pos=pb.get();
-      auto pg=arrays.groups()+pos;
+      auto pg=group_at(arrays,pos);
       auto mask=pg->match(hash);
       if(mask){
         auto elements=arrays.elements();
         BOOST_UNORDERED_ASSUME(elements!=nullptr);
-        auto p=elements+pos*N;
+        auto p=elements+pos*element_stride;
         BOOST_UNORDERED_PREFETCH_ELEMENTS(p,N);
         do{
           auto n=unchecked_countr_zero(mask);
-          if(BOOST_LIKELY(bool(pred()(x,key_from(p[n]))))){
+          if(BOOST_LIKELY(bool(pred()(lookup_key(x),key_from(p[n]))))){
             return {pg,n,p+n};
           }
           mask&=mask-1;
@@ -1620,6 +2096,39 @@ public:
     return {};
   }
 
+  template<typename Key>
+  BOOST_FORCEINLINE locator find(
+    const Key& x,std::size_t pos0,std::size_t hash,
+    std::true_type /* split keys */)const
+  {    
+    prober pb(pos0);
+    do{
+      auto pos=pb.get();
+      auto pg=group_at(arrays,pos);
+      auto mask=pg->match(hash);
+      if(mask){
+        auto keys=arrays.keys();
+        BOOST_UNORDERED_ASSUME(keys!=nullptr);
+        auto pk=keys+pos*N;
+        BOOST_UNORDERED_PREFETCH_ELEMENTS(pk,N);
+        BOOST_UNORDERED_PREFETCH(
+          elements_at(arrays,pos)+unchecked_countr_zero(mask));
+        do{
+          auto n=unchecked_countr_zero(mask);
+          if(BOOST_LIKELY(bool(pred()(lookup_key(x),pk[n])))){
+            return {pg,n,elements_at(arrays,pos)+n};
+          }
+          mask&=mask-1;
+        }while(mask);
+      }
+      if(BOOST_LIKELY(pg->is_not_overflowed(hash))){
+        return {};
+      }
+    }
+    while(BOOST_LIKELY(pb.next(arrays.groups_size_mask)));
+    return {};
+  }
+
 #if defined(BOOST_MSVC)
 #pragma warning(pop) /* C4800 */
 #endif
@@ -1653,8 +2162,9 @@ public:
   {
     auto p=arrays.elements();
     if(p){
-      for(auto pg=arrays.groups(),last=pg+arrays.groups_size_mask+1;
-          pg!=last;++pg,p+=N){
+      for(auto pg=arrays.groups(),
+               last=pg+(arrays.groups_size_mask+1)*group_stride;
+          pg!=last;pg+=group_stride,p+=element_stride){
         auto mask=match_really_occupied(pg,last);
         while(mask){
           destroy_element(p+unchecked_countr_zero(mask));
@@ -1663,7 +2173,7 @@ public:
         /* we wipe the entire metadata to reset the overflow byte as well */
         pg->initialize();
       }
-      arrays.groups()[arrays.groups_size_mask].set_sentinel();
+      group_at(arrays,arrays.groups_size_mask)->set_sentinel();
       size_ctrl.ml=initial_max_load();
       size_ctrl.size=0;
     }
@@ -1701,6 +2211,250 @@ public:
     rehash(std::size_t(std::ceil(float(n)/mlf)));
   }
 
+  /* Raw binary image: a table_image_header followed by the groups and
+   * elements arrays written verbatim. Loading allocates arrays of the saved
+   * size and reads them back as they are, without rehashing, as long as the
+   * hash values of a sample of the elements (the sampled hash digest) are
+   * reproduced by the current hash function; otherwise, the elements are
+   * rehashed into new arrays of the same size. Only enabled when elements
+   * can be memcpy'd, under the same conditions as in
+   * copy_elements_array_from.
+   */
+
+  static constexpr bool image_enabled=
+    std::is_same<element_type,value_type>::value&&
+    is_trivially_copy_constructible<element_type>::value&&
+    std::is_trivially_destructible<element_type>::value&&
+    is_trivially_copy_assignable<group_type>::value&&group_stride==1&&(
+      is_std_allocator<Allocator>::value||
+      !alloc_has_construct<Allocator,value_type*,const value_type&>::value);
+
+  template<typename OStream>
+  void save_image(OStream& os)const
+  {
+    BOOST_UNORDERED_STATIC_ASSERT(image_enabled);
+
+    table_image_header h;
+    h.set_format<group_type,element_type>();
+    h.size=size();
+    h.ml=std::size_t(size_ctrl.ml);
+    h.groups_size_index=arrays.elements()?arrays.groups_size_index:0;
+    h.sampled_hash_digest=sampled_hash_digest();
+
+    write_image_bytes(os,&h,sizeof(h));
+    if(arrays.elements()){
+      write_image_bytes(
+        os,arrays.groups(),(arrays.groups_size_mask+1)*sizeof(group_type));
+      write_image_bytes(
+        os,arrays.elements(),capacity()*sizeof(element_type));
+    }
+  }
+
+  template<typename IStream>
+  void load_image(IStream& is)
+  {
+    BOOST_UNORDERED_STATIC_ASSERT(image_enabled);
+
+    table_image_header h;
+    read_image_bytes(is,&h,sizeof(h));
+    if(!h.has_format<group_type,element_type>()||
+       h.groups_size_index>=sizeof(std::size_t)*CHAR_BIT){
+      throw_exception(bad_archive_exception());
+    }
+    if(h.groups_size_index==0){
+      if(h.size!=0)throw_exception(bad_archive_exception());
+      clear();
+      return;
+    }
+
+    auto groups_size=
+      size_policy::size(static_cast<std::size_t>(h.groups_size_index));
+    auto ah=make_arrays(groups_size*N-1);
+    auto pg=ah.get().groups();
+    read_image_bytes(is,pg,groups_size*sizeof(group_type));
+    read_image_bytes(
+      is,ah.get().elements(),(groups_size*N-1)*sizeof(element_type));
+
+    /* sanity checks on metadata before trusting it */
+    std::size_t num_occupied=0;
+    if(pg[groups_size-1].is_sentinel(N-1)){
+      for_all_elements(ah.get(),[&](element_type*){++num_occupied;});
+    }
+    if(num_occupied!=h.size||h.size>h.ml||h.ml>groups_size*N-1){
+      throw_exception(bad_archive_exception());
+    }
+    record_keys(ah.get());
+
+    clear();
+    delete_arrays(arrays);
+    arrays=ah.release();
+    size_ctrl.ml=static_cast<std::size_t>(h.ml);
+    size_ctrl.size=static_cast<std::size_t>(h.size);
+    if(sampled_hash_digest()!=h.sampled_hash_digest){
+      BOOST_TRY{
+        unchecked_rehash(capacity());
+      }
+      BOOST_CATCH(...){
+        clear();
+        BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+    }
+  }
+
+  /* Layout-preserving serialization: the slot and hash value of each
+   * element are saved along with the element itself (written by f), and the
+   * capacity of the table is recorded, so that loading into a table with the
+   * same hash function can construct each element directly at its original
+   * slot without hashing its key or checking for duplicates. If both the
+   * saving and loading hash functions have a hash fingerprint, they're
+   * compared to decide whether elements are placed directly or inserted
+   * the regular way; otherwise, the hash function is validated on the first
+   * elements loaded, and on mismatch the remaining elements are inserted the
+   * regular way.
+   */
+
+  template<typename Archive,typename F>
+  void save_layout(Archive& ar,F f)const
+  {
+    const std::size_t gsi=arrays.elements()?arrays.groups_size_index:0;
+    const std::size_t s=size();
+
+    save_hash_fingerprint(ar);
+    ar<<core::make_nvp("groups_size_index",gsi);
+    ar<<core::make_nvp("count",s);
+    for_all_elements([&,this](group_type* pg,unsigned int n,element_type* p){
+      const std::size_t slot=position_of(arrays,pg)*N+n;
+      const std::size_t hash=hash_for(key_from(*p));
+
+      ar<<core::make_nvp("slot",slot);
+      ar<<core::make_nvp("hash",hash);
+      f(pg,n,p);
+    });
+  }
+
+  /* clears the table and sets up arrays of the saved capacity; returns the
+   * number of elements to be loaded with unchecked_emplace_from_layout,
+   * and sets direct and check to be passed to it (through layout_check_for)
+   */
+
+  template<typename Archive>
+  std::size_t load_layout_arrays(Archive& ar,bool& direct,bool& check)
+  {
+    auto match=load_hash_fingerprint(ar);
+    direct=match!=hash_fingerprint_match::different;
+    check=match==hash_fingerprint_match::unknown;
+
+    std::size_t gsi,s;
+    ar>>core::make_nvp("groups_size_index",gsi);
+    ar>>core::make_nvp("count",s);
+    if(gsi>=sizeof(std::size_t)*CHAR_BIT||(gsi==0&&s!=0)){
+      throw_exception(bad_archive_exception());
+    }
+
+    clear_for_layout(gsi);
+    if(s>size_ctrl.ml)throw_exception(bad_archive_exception());
+    return s;
+  }
+
+  /* clears the table and, if gsi!=0, sets up arrays with groups size
+   * index gsi
+   */
+
+  void clear_for_layout(std::size_t gsi)
+  {
+    clear();
+    if(gsi!=0&&(!arrays.elements()||arrays.groups_size_index!=gsi)){
+      auto new_arrays_=new_arrays(size_policy::size(gsi)*N-1);
+      delete_arrays(arrays);
+      arrays=new_arrays_;
+      size_ctrl.ml=initial_max_load();
+    }
+  }
+
+  /* with an unknown hash fingerprint, hash values of the elements loaded are
+   * verified: all of them if the hash function is cheap, and only the first
+   * digest_sample_size() ones otherwise
+   */
+
+  static bool layout_check_for(bool check,std::size_t n)
+  {
+    return check&&
+      (cheap_hash||n<table_image_header::digest_sample_size());
+  }
+
+  /* direct is set to false (for this and all subsequent calls) if check
+   * is true and hash is not reproduced by the hash function
+   */
+
+  template<typename Key,typename... Args>
+  locator unchecked_emplace_from_layout(
+    std::size_t slot,std::size_t hash,bool& direct,bool check,
+    const Key& x,Args&&... args)
+  {
+    if(direct&&check&&hash_for(x)!=hash)direct=false;
+    if(!direct){
+      hash=hash_for(x);
+      auto pos0=position_for(hash);
+      if(find(x,pos0,hash)||size_ctrl.size>=size_ctrl.ml){
+        throw_exception(bad_archive_exception());
+      }
+      return unchecked_emplace_at(pos0,hash,std::forward<Args>(args)...);
+    }
+
+    auto pos=slot/N;
+    auto n=static_cast<unsigned int>(slot%N);
+    auto pg=group_at(arrays,pos);
+    if(slot>=capacity()||!(pg->match_available()&(1<<n))||
+       size_ctrl.size>=size_ctrl.ml){
+      throw_exception(bad_archive_exception());
+    }
+
+    /* groups skipped when the element was originally inserted */
+    for(prober pb(position_for(hash));pb.get()!=pos;){
+      group_at(arrays,pb.get())->mark_overflow(hash);
+      if(!pb.next(arrays.groups_size_mask)){
+        throw_exception(bad_archive_exception());
+      }
+    }
+
+    auto p=elements_at(arrays,pos)+n;
+    construct_element(p,std::forward<Args>(args)...);
+    record_key(arrays,p);
+    pg->set(n,hash);
+    ++size_ctrl.size;
+    return {pg,n,p};
+  }
+
+  static constexpr bool has_hash_fingerprint=
+    boost::unordered::detail::has_hash_fingerprint<Hash>::value;
+
+  template<typename Archive>
+  void save_hash_fingerprint(Archive& ar)const
+  {
+    const bool            available=has_hash_fingerprint;
+    const boost::uint64_t fp=hasher_fingerprint();
+
+    ar<<core::make_nvp("has_hash_fingerprint",available);
+    if(available)ar<<core::make_nvp("hash_fingerprint",fp);
+  }
+
+  template<typename Archive>
+  hash_fingerprint_match load_hash_fingerprint(Archive& ar)const
+  {
+    bool            available;
+    boost::uint64_t fp;
+
+    ar>>core::make_nvp("has_hash_fingerprint",available);
+    if(!available||!has_hash_fingerprint){
+      if(available)ar>>core::make_nvp("hash_fingerprint",fp);
+      return hash_fingerprint_match::unknown;
+    }
+    ar>>core::make_nvp("hash_fingerprint",fp);
+    return fp==hasher_fingerprint()?
+      hash_fingerprint_match::equal:hash_fingerprint_match::different;
+  }
+
   friend bool operator==(const table_core& x,const table_core& y)
   {
     return
@@ -1718,6 +2472,96 @@ public:
     return !(x==y);
   }
 
+  boost::uint64_t hasher_fingerprint()const
+  {
+    return hasher_fingerprint(
+      std::integral_constant<bool,has_hash_fingerprint>{});
+  }
+
+  boost::uint64_t hasher_fingerprint(std::true_type)const
+  {
+    return boost::unordered::hash_fingerprint<Hash>::get(h())^
+      mix_policy::fingerprint;
+  }
+
+  boost::uint64_t hasher_fingerprint(std::false_type)const{return 0;}
+
+  boost::uint64_t sampled_hash_digest()const
+  {
+    boost::uint64_t fp=0;
+    std::size_t     n=table_image_header::digest_sample_size();
+    for_all_elements_while([&,this](element_type* p){
+      fp=table_image_header::combine_digest(fp,hash_for(key_from(*p)));
+      return --n!=0;
+    });
+    return fp;
+  }
+
+#if defined(BOOST_UNORDERED_ENABLE_HASH_QUALITY_MONITOR)
+  boost::unordered::hash_quality_report hash_quality()const
+  {
+    boost::unordered::hash_quality_report r;
+    std::size_t                           and_bits=~std::size_t(0),or_bits=0;
+
+    r.groups=arrays.groups_size_mask+1;
+    r.position_bits=sizeof(std::size_t)*CHAR_BIT-arrays.groups_size_index;
+    for_all_elements([&,this](group_type* pg,unsigned int,element_type* p){
+      auto        hash=hash_for(key_from(*p));
+      auto        pos=position_of(arrays,pg);
+      std::size_t len=0;
+
+      ++r.size;
+      and_bits&=hash;
+      or_bits|=hash;
+      for(prober pb(position_for(hash));pb.get()!=pos;){
+        ++len;
+        if(!pb.next(arrays.groups_size_mask))break;
+      }
+      if(len){
+        ++r.displaced;
+        if(len>r.max_probe_length)r.max_probe_length=len;
+      }
+    });
+    if(r.size){
+      auto varying=and_bits^or_bits;
+      r.constant_position_bits=r.position_bits-static_cast<std::size_t>(
+        boost::core::popcount(varying>>arrays.groups_size_index));
+      r.constant_reduced_hash_bits=8-static_cast<std::size_t>(
+        boost::core::popcount(varying&0xFFu));
+    }
+    return r;
+  }
+
+  /* called on rehash, so that checking is amortized over insertions */
+
+  void monitor_hash_quality()const
+  {
+    auto handler=boost::unordered::get_hash_quality_handler();
+    if(handler&&
+       size()>=boost::unordered::hash_quality_report::min_size()){
+      auto r=hash_quality();
+      if(r.degenerate())handler(r);
+    }
+  }
+#endif
+
+  template<typename OStream>
+  static void write_image_bytes(OStream& os,const void* p,std::size_t n)
+  {
+    if(!os.write(
+      static_cast<const char*>(p),static_cast<std::ptrdiff_t>(n))){
+      throw_exception(bad_archive_exception());
+    }
+  }
+
+  template<typename IStream>
+  static void read_image_bytes(IStream& is,void* p,std::size_t n)
+  {
+    if(!is.read(static_cast<char*>(p),static_cast<std::ptrdiff_t>(n))){
+      throw_exception(bad_archive_exception());
+    }
+  }
+
   struct clear_on_exit
   {
     ~clear_on_exit(){x.clear();}
@@ -1751,6 +2595,73 @@ public:
     type_policy::destroy(al(),p);
   }
 
+  /* With split_table_arrays, the key of each newly placed element is copied
+   * into the key array of the arrays it's placed in: this is done wherever
+   * elements are given a slot rather than in construct_element, which does
+   * not know about slots.
+   */
+
+  static void record_key(const arrays_type& arrays_,const element_type* p)
+  {
+    record_key(arrays_,p,std::integral_constant<bool,split_keys>{});
+  }
+
+  static void record_key(
+    const arrays_type&,const element_type*,std::false_type)
+  {}
+
+  static void record_key(
+    const arrays_type& arrays_,const element_type* p,std::true_type)
+  {
+    arrays_.keys()[p-arrays_.elements()]=key_from(*p);
+  }
+
+  static void record_keys(const arrays_type& arrays_)
+  {
+    record_keys(arrays_,std::integral_constant<bool,split_keys>{});
+  }
+
+  static void record_keys(const arrays_type&,std::false_type){}
+
+  static void record_keys(const arrays_type& arrays_,std::true_type)
+  {
+    for_all_elements(arrays_,[&](element_type* p){
+      record_key(arrays_,p,std::true_type{});
+    });
+  }
+
+  /* used on transfer of groups and elements from/to a concurrent table: the
+   * key array is allocated before the arrays are taken over, so that
+   * allocation failure leaves the source table untouched
+   */
+
+  static arrays_type with_key_array(const Allocator& al_,arrays_type arrays_)
+  {
+    with_key_array(
+      al_,arrays_,std::integral_constant<bool,split_keys>{});
+    return arrays_;
+  }
+
+  static void with_key_array(const Allocator&,arrays_type&,std::false_type){}
+
+  static void with_key_array(
+    const Allocator& al_,arrays_type& arrays_,std::true_type)
+  {
+    arrays_type::set_keys(al_,arrays_);
+  }
+
+  void delete_key_array()noexcept
+  {
+    delete_key_array(std::integral_constant<bool,split_keys>{});
+  }
+
+  void delete_key_array(std::false_type)noexcept{}
+
+  void delete_key_array(std::true_type)noexcept
+  {
+    arrays_type::delete_keys(al(),arrays);
+  }
+
   struct destroy_element_on_exit
   {
     ~destroy_element_on_exit(){this_->destroy_element(p);}
@@ -1778,6 +2689,46 @@ public:
     return mix_policy::mix(h(),x);
   }
 
+  /* hashes[i]=hash_for(*(first+i)), i in [0,n), computed through
+   * hash_batch<Hash> if available. Post-mixing is applied one hash value at
+   * a time: an SSE2 batch of mulx_narrow over the block measured slower in
+   * bulk visit than hashing and mixing each key in one go, and mulx needs a
+   * 64x64->128 product SIMD units lack.
+   */
+
+  template<typename FwdIterator>
+  inline void hash_for_batch(
+    FwdIterator first,std::size_t n,std::size_t* hashes)const
+  {
+    hash_for_batch(
+      first,n,hashes,
+      std::integral_constant<
+        bool,
+        boost::unordered::detail::has_hash_batch<Hash,FwdIterator>::value&&
+        !boost::unordered::detail::is_hashed_key<
+          typename std::iterator_traits<FwdIterator>::value_type>::value
+      >{});
+  }
+
+  template<typename FwdIterator>
+  inline void hash_for_batch(
+    FwdIterator first,std::size_t n,std::size_t* hashes,
+    std::true_type /* hash_batch */)const
+  {
+    boost::unordered::hash_batch<Hash>::apply(h(),first,n,hashes);
+    for(std::size_t i=0;i<n;++i){
+      hashes[i]=mix_policy::mix_hash(h(),hashes[i]);
+    }
+  }
+
+  template<typename FwdIterator>
+  inline void hash_for_batch(
+    FwdIterator first,std::size_t n,std::size_t* hashes,
+    std::false_type /* scalar */)const
+  {
+    for(std::size_t i=0;i<n;++i,++first)hashes[i]=hash_for(*first);
+  }
+
   inline std::size_t position_for(std::size_t hash)const
   {
     return position_for(hash,arrays);
@@ -1789,10 +2740,29 @@ public:
     return size_policy::position(hash,arrays_.groups_size_index);
   }
 
+  /* group and first slot at position pos (group_stride and element_stride
+   * are 1 and N except for interleaved_table_arrays)
+   */
+
+  static group_type* group_at(const arrays_type& arrays_,std::size_t pos)
+  {
+    return arrays_.groups()+pos*group_stride;
+  }
+
+  static element_type* elements_at(const arrays_type& arrays_,std::size_t pos)
+  {
+    return arrays_.elements()+pos*element_stride;
+  }
+
+  static std::size_t position_of(const arrays_type& arrays_,group_type* pg)
+  {
+    return static_cast<std::size_t>(pg-arrays_.groups())/group_stride;
+  }
+
   static inline int match_really_occupied(group_type* pg,group_type* last)
   {
     /* excluding the sentinel */
-    return pg->match_occupied()&~(int(pg==last-1)<<(N-1));
+    return pg->match_occupied()&~(int(pg==last-group_stride)<<(N-1));
   }
 
   template<typename... Args>
@@ -1835,6 +2805,56 @@ public:
     return it;
   }
 
+  /* Elements of a table x with the same number of groups and an equal hash
+   * function (taken to be the case when both use the same stateless hasher
+   * type) can be transferred to the group of the same index in *this,
+   * reusing their reduced hash values instead of hashing again: once x's
+   * overflow bits are carried over (import_overflow), lookups starting at an
+   * element's initial position will still reach it. Elements finding no room
+   * in their group are inserted the usual way. Caller is responsible for
+   * checking there are no duplicate keys if *this requires unique keys.
+   */
+
+  template<typename Hash2>
+  bool transfer_layout_compatible(
+    const arrays_type& xarrays,std::size_t xsize)const
+  {
+    return
+      std::is_same<Hash,Hash2>::value&&std::is_empty<Hash>::value&&
+      xsize!=0&&
+      arrays.groups_size_index==xarrays.groups_size_index&&
+      std::size_t(size_ctrl.size)+xsize<=std::size_t(size_ctrl.ml);
+  }
+
+  void import_overflow(const arrays_type& xarrays)
+  {
+    for(std::size_t i=0;i<arrays.groups_size_mask+1;++i){
+      group_at(arrays,i)->mark_overflow(*group_at(xarrays,i));
+    }
+  }
+
+  locator unchecked_transfer(
+    const arrays_type& xarrays,group_type* xpg,unsigned int xn,element_type* xp)
+  {
+    auto pos=position_of(xarrays,xpg);
+    auto pg=group_at(arrays,pos);
+    auto mask=pg->match_available();
+    if(BOOST_LIKELY(mask!=0)){
+      auto n=unchecked_countr_zero(mask);
+      auto p=elements_at(arrays,pos)+n;
+      construct_element(p,type_policy::move(*xp));
+      record_key(arrays,p);
+      pg->set(n,*xpg,xn);
+      ++size_ctrl.size;
+      return {pg,n,p};
+    }
+    else{
+      auto hash=hash_for(key_from(*xp));
+      return unchecked_emplace_at(
+        position_for(hash),hash,type_policy::move(*xp));
+    }
+  }
+
   void noshrink_reserve(std::size_t n)
   {
     /* used only on assignment after element clearance */
@@ -1895,8 +2915,9 @@ public:
   {
     auto p=arrays_.elements();
     if(p){
-      for(auto pg=arrays_.groups(),last=pg+arrays_.groups_size_mask+1;
-          pg!=last;++pg,p+=N){
+      for(auto pg=arrays_.groups(),
+               last=pg+(arrays_.groups_size_mask+1)*group_stride;
+          pg!=last;pg+=group_stride,p+=element_stride){
         auto mask=match_really_occupied(pg,last);
         while(mask){
           auto n=unchecked_countr_zero(mask);
@@ -2004,6 +3025,7 @@ private:
     if(arrays.elements()&&x.arrays.elements()){
       copy_elements_array_from(x);
       copy_groups_array_from(x);
+      record_keys(arrays);
       size_ctrl.ml=std::size_t(x.size_ctrl.ml);
       size_ctrl.size=std::size_t(x.size_ctrl.size);
     }
@@ -2031,7 +3053,7 @@ private:
     std::memcpy(
       reinterpret_cast<unsigned char*>(arrays.elements()),
       reinterpret_cast<unsigned char*>(x.arrays.elements()),
-      x.capacity()*sizeof(value_type));
+      (x.arrays.groups_size_mask*element_stride+N-1)*sizeof(value_type));
   }
 
   void copy_elements_array_from(
@@ -2057,7 +3079,13 @@ private:
   }
 
   void copy_groups_array_from(const table_core& x) {
-    copy_groups_array_from(x,is_trivially_copy_assignable<group_type>{});
+    copy_groups_array_from(
+      x,
+      std::integral_constant<
+        bool,
+        is_trivially_copy_assignable<group_type>::value&&group_stride==1
+      >{}
+    );
   }
 
   void copy_groups_array_from(
@@ -2071,10 +3099,8 @@ private:
   void copy_groups_array_from(
     const table_core& x, std::false_type /* -> manual */) 
   {
-    auto pg=arrays.groups();
-    auto xpg=x.arrays.groups();
     for(std::size_t i=0;i<arrays.groups_size_mask+1;++i){
-      pg[i]=xpg[i];
+      *group_at(arrays,i)=*group_at(x.arrays,i);
     }
   }
 
@@ -2140,6 +3166,9 @@ private:
     delete_arrays(arrays);
     arrays=new_arrays_;
     size_ctrl.ml=initial_max_load();
+#if defined(BOOST_UNORDERED_ENABLE_HASH_QUALITY_MONITOR)
+    monitor_hash_quality();
+#endif
   }
 
   template<typename Value>
@@ -2191,12 +3220,13 @@ private:
   {
     for(prober pb(pos0);;pb.next(arrays_.groups_size_mask)){
       auto pos=pb.get();
-      auto pg=arrays_.groups()+pos;
+      auto pg=group_at(arrays_,pos);
       auto mask=pg->match_available();
       if(BOOST_LIKELY(mask!=0)){
         auto n=unchecked_countr_zero(mask);
-        auto p=arrays_.elements()+pos*N+n;
+        auto p=elements_at(arrays_,pos)+n;
         construct_element(p,std::forward<Args>(args)...);
+        record_key(arrays_,p);
         pg->set(n,hash);
         return {pg,n,p};
       }
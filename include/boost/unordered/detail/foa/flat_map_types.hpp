@@ -6,6 +6,7 @@
 #define BOOST_UNORDERED_DETAIL_FOA_FLAT_MAP_TYPES_HPP
 
 #include <boost/core/allocator_access.hpp>
+#include <boost/unordered/unordered_flat_map_fwd.hpp>
 
 namespace boost {
   namespace unordered {
@@ -24,6 +25,14 @@ namespace boost {
 
           using element_type = value_type;
 
+          // used by unordered_flat_map only, see split_table_arrays
+          static constexpr bool split_keys =
+            boost::unordered::flat_map_split_layout<Key, T>::value;
+
+          // used by unordered_flat_map only, see interleaved_table_arrays
+          static constexpr bool interleaved =
+            boost::unordered::flat_map_interleaved_layout<Key, T>::value;
+
           static value_type& value_from(element_type& x) { return x; }
 
           template <class K, class V>
@@ -6,6 +6,7 @@
 #define BOOST_UNORDERED_DETAIL_FOA_FLAT_SET_TYPES_HPP
 
 #include <boost/core/allocator_access.hpp>
+#include <boost/unordered/unordered_flat_set_fwd.hpp>
 
 namespace boost {
   namespace unordered {
@@ -21,6 +22,10 @@ namespace boost {
 
           using element_type = value_type;
 
+          // used by unordered_flat_set only, see interleaved_table_arrays
+          static constexpr bool interleaved =
+            boost::unordered::flat_set_interleaved_layout<Key>::value;
+
           static Key& value_from(element_type& x) { return x; }
 
           static element_type&& move(element_type& x) { return std::move(x); }
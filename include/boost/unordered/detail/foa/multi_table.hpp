@@ -0,0 +1,544 @@
+/* Fast open-addressing hash table with equivalent keys.
+ *
+ * Copyright 2026 agent.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See https://www.boost.org/libs/unordered for library home page.
+ */
+
+#ifndef BOOST_UNORDERED_DETAIL_FOA_MULTI_TABLE_HPP
+#define BOOST_UNORDERED_DETAIL_FOA_MULTI_TABLE_HPP
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/unordered/detail/foa/core.hpp>
+#include <boost/unordered/detail/foa/table.hpp>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace boost{
+namespace unordered{
+namespace detail{
+namespace foa{
+
+/* table_equal_range_iterator traverses the elements with keys equivalent to
+ * a given one by resuming the probing sequence where the previous element
+ * was found: the remaining bits of the current group match(hash) mask are
+ * visited first, and then subsequent groups are probed until one is found
+ * not to be overflowed for hash. Key comparison is done against the element
+ * currently pointed to, so the lookup key needs not outlive the iterator.
+ *
+ * Equivalent elements are not adjacent in regular iteration order, hence the
+ * need for a separate iterator type. Iterators are invalidated by rehashing
+ * and by erasure of the pointed-to element; erasing other elements of the
+ * range is fine (erase(it++) is the idiomatic way to remove elements while
+ * traversing).
+ *
+ * table_equal_range_iterator converts implicitly to the corresponding
+ * table_iterator. p = nullptr marks the end of the range.
+ */
+
+template<typename TypePolicy,typename GroupPtr,typename Pred,bool Const>
+class table_equal_range_iterator
+{
+  using group_pointer_traits=boost::pointer_traits<GroupPtr>;
+  using type_policy=TypePolicy;
+  using table_element_type=typename type_policy::element_type;
+  using group_type=typename group_pointer_traits::element_type;
+  using prober=pow2_quadratic_prober;
+  static constexpr auto N=group_type::N;
+
+public:
+  using difference_type=std::ptrdiff_t;
+  using value_type=typename type_policy::value_type;
+  using pointer=
+    typename std::conditional<Const,value_type const*,value_type*>::type;
+  using reference=
+    typename std::conditional<Const,value_type const&,value_type&>::type;
+  using iterator_category=std::forward_iterator_tag;
+  using element_type=
+    typename std::conditional<Const,value_type const,value_type>::type;
+
+  table_equal_range_iterator():pb{0}{}
+  template<bool Const2,typename std::enable_if<!Const2>::type* =nullptr>
+  table_equal_range_iterator(
+    const table_equal_range_iterator<TypePolicy,GroupPtr,Pred,Const2>& x):
+    groups{x.groups},elements{x.elements},groups_size_mask{x.groups_size_mask},
+    pred{x.pred},pb{x.pb},hash{x.hash},mask{x.mask},n{x.n},p{x.p}{}
+
+  template<
+    bool Const2,
+    typename std::enable_if<!Const||Const2>::type* =nullptr
+  >
+  operator table_iterator<TypePolicy,GroupPtr,Const2>()const noexcept
+  {
+    if(!p)return {};
+    return {groups+pb.get(),n,p};
+  }
+
+  inline reference operator*()const noexcept
+    {return type_policy::value_from(*p);}
+  inline pointer operator->()const noexcept
+    {return std::addressof(type_policy::value_from(*p));}
+  inline table_equal_range_iterator& operator++(){increment();return *this;}
+  inline table_equal_range_iterator operator++(int)
+    {auto x=*this;increment();return x;}
+  friend inline bool operator==(
+    const table_equal_range_iterator& x,const table_equal_range_iterator& y)
+    {return x.p==y.p;}
+  friend inline bool operator!=(
+    const table_equal_range_iterator& x,const table_equal_range_iterator& y)
+    {return !(x==y);}
+
+private:
+  template<typename,typename,typename,bool>
+  friend class table_equal_range_iterator;
+  template<typename,typename,typename,typename> friend class multi_table;
+
+  table_equal_range_iterator(
+    group_type* groups_,table_element_type* elements_,
+    std::size_t groups_size_mask_,const Pred& pred_,
+    std::size_t pos0,std::size_t hash_):
+    groups{groups_},elements{elements_},groups_size_mask{groups_size_mask_},
+    pred{std::addressof(pred_)},pb{pos0},hash{hash_}
+  {}
+
+#if defined(BOOST_MSVC)
+/* warning: forcing value to bool 'true' or 'false' in bool(pred()...) */
+#pragma warning(push)
+#pragma warning(disable:4800)
+#endif
+
+  /* positions the iterator at the first element equivalent to x, or at
+   * the end of the range if there's none.
+   */
+
+  template<typename Key>
+  BOOST_FORCEINLINE void find_first(const Key& x)
+  {
+    if(!elements)return;
+    const auto& k=lookup_key(x);
+    mask=groups[pb.get()].match(hash);
+    seek([&](const table_element_type& e){
+      return bool((*pred)(k,type_policy::extract(e)));
+    });
+  }
+
+  void increment()
+  {
+    BOOST_ASSERT(p!=nullptr);
+    const auto& k=type_policy::extract(*p);
+    seek([&](const table_element_type& e){
+      return bool((*pred)(k,type_policy::extract(e)));
+    });
+  }
+
+#if defined(BOOST_MSVC)
+#pragma warning(pop) /* C4800 */
+#endif
+
+  template<typename F>
+  BOOST_FORCEINLINE void seek(F f)
+  {
+    for(;;){
+      if(mask){
+        auto pe=elements+pb.get()*N;
+        BOOST_UNORDERED_PREFETCH_ELEMENTS(pe,N);
+        do{
+          auto m=unchecked_countr_zero(mask);
+          mask&=mask-1;
+          if(f(pe[m])){
+            n=static_cast<unsigned int>(m);
+            p=pe+m;
+            return;
+          }
+        }while(mask);
+      }
+      if(BOOST_LIKELY(groups[pb.get()].is_not_overflowed(hash))||
+         !pb.next(groups_size_mask)){
+        p=nullptr;
+        return;
+      }
+      mask=groups[pb.get()].match(hash);
+    }
+  }
+
+  group_type*         groups=nullptr;
+  table_element_type* elements=nullptr;
+  std::size_t         groups_size_mask=0;
+  const Pred*         pred=nullptr;
+  prober              pb;
+  std::size_t         hash=0;
+  int                 mask=0;
+  unsigned int        n=0;
+  table_element_type* p=nullptr;
+};
+
+/* foa::multi_table is the equivalent-key counterpart of foa::table, with
+ * which it shares the underlying table_core and iterator types. Insertion
+ * does not look up the key, and lookup operations other than find keep on
+ * probing after the first match via table_equal_range_iterator, so the cost
+ * of equal_range, count and erase(key) is that of one unsuccessful lookup
+ * regardless of the number of equivalent elements found (as long as these
+ * spread over few groups).
+ */
+
+#include <boost/unordered/detail/foa/ignore_wshadow.hpp>
+
+#if defined(BOOST_MSVC)
+#pragma warning(push)
+#pragma warning(disable:4714) /* marked as __forceinline not inlined */
+#endif
+
+template<typename TypePolicy,typename Hash,typename Pred,typename Allocator>
+class multi_table:table_core_impl<TypePolicy,Hash,Pred,Allocator>
+{
+  using super=table_core_impl<TypePolicy,Hash,Pred,Allocator>;
+  using type_policy=typename super::type_policy;
+  using group_type=typename super::group_type;
+  using super::N;
+  using prober=typename super::prober;
+  using arrays_type=typename super::arrays_type;
+  using size_ctrl_type=typename super::size_ctrl_type;
+  using locator=typename super::locator;
+  using group_type_pointer=typename boost::pointer_traits<
+    typename boost::allocator_pointer<Allocator>::type
+  >::template rebind<group_type>;
+
+public:
+  using key_type=typename super::key_type;
+  using init_type=typename super::init_type;
+  using value_type=typename super::value_type;
+  using element_type=typename super::element_type;
+
+private:
+  static constexpr bool has_mutable_iterator=
+    !std::is_same<key_type,value_type>::value;
+public:
+  using hasher=typename super::hasher;
+  using key_equal=typename super::key_equal;
+  using allocator_type=typename super::allocator_type;
+  using pointer=typename super::pointer;
+  using const_pointer=typename super::const_pointer;
+  using reference=typename super::reference;
+  using const_reference=typename super::const_reference;
+  using size_type=typename super::size_type;
+  using difference_type=typename super::difference_type;
+  using const_iterator=table_iterator<type_policy,group_type_pointer,true>;
+  using iterator=typename std::conditional<
+    has_mutable_iterator,
+    table_iterator<type_policy,group_type_pointer,false>,
+    const_iterator>::type;
+  using erase_return_type=table_erase_return_type<iterator>;
+  using const_equal_range_iterator=table_equal_range_iterator<
+    type_policy,group_type_pointer,key_equal,true>;
+  using equal_range_iterator=typename std::conditional<
+    has_mutable_iterator,
+    table_equal_range_iterator<
+      type_policy,group_type_pointer,key_equal,false>,
+    const_equal_range_iterator>::type;
+
+  multi_table(
+    std::size_t n=default_bucket_count,const Hash& h_=Hash(),
+    const Pred& pred_=Pred(),const Allocator& al_=Allocator()):
+    super{n,h_,pred_,al_}
+    {}
+
+  multi_table(const multi_table& x)=default;
+  multi_table(multi_table&& x)=default;
+  multi_table(const multi_table& x,const Allocator& al_):super{x,al_}{}
+  multi_table(multi_table&& x,const Allocator& al_):super{std::move(x),al_}{}
+  ~multi_table()=default;
+
+  multi_table& operator=(const multi_table& x)=default;
+  multi_table& operator=(multi_table&& x)=default;
+
+  using super::get_allocator;
+
+  iterator begin()noexcept
+  {
+    iterator it{this->arrays.groups(),0,this->arrays.elements()};
+    if(this->arrays.elements()&&
+       !(this->arrays.groups()[0].match_occupied()&0x1))++it;
+    return it;
+  }
+
+  const_iterator begin()const noexcept
+                   {return const_cast<multi_table*>(this)->begin();}
+  iterator       end()noexcept{return {};}
+  const_iterator end()const noexcept
+                   {return const_cast<multi_table*>(this)->end();}
+  const_iterator cbegin()const noexcept{return begin();}
+  const_iterator cend()const noexcept{return end();}
+
+  using super::empty;
+  using super::size;
+  using super::max_size;
+
+  template<typename... Args>
+  BOOST_FORCEINLINE iterator emplace(Args&&... args)
+  {
+    auto x=alloc_make_insert_type<type_policy>(
+      this->al(),std::forward<Args>(args)...);
+    return emplace_impl(type_policy::move(x.value()));
+  }
+
+  BOOST_FORCEINLINE iterator insert(const init_type& x)
+  {return emplace_impl(x);}
+
+  BOOST_FORCEINLINE iterator insert(init_type&& x)
+  {return emplace_impl(std::move(x));}
+
+  /* template<typename=void> tilts call ambiguities in favor of init_type */
+
+  template<typename=void>
+  BOOST_FORCEINLINE iterator insert(const value_type& x)
+  {return emplace_impl(x);}
+
+  template<typename=void>
+  BOOST_FORCEINLINE iterator insert(value_type&& x)
+  {return emplace_impl(std::move(x));}
+
+  template<typename T=element_type>
+  BOOST_FORCEINLINE
+  typename std::enable_if<!std::is_same<T,value_type>::value,iterator>::type
+  insert(element_type&& x){return emplace_impl(std::move(x));}
+
+  template<
+    bool dependent_value=false,
+    typename std::enable_if<
+      has_mutable_iterator||dependent_value>::type* =nullptr
+  >
+  erase_return_type erase(iterator pos)noexcept
+  {return erase(const_iterator(pos));}
+
+  BOOST_FORCEINLINE
+  erase_return_type erase(const_iterator pos)noexcept
+  {
+    super::erase(pos.pc(),pos.p());
+    return {pos};
+  }
+
+  template<typename Key>
+  BOOST_FORCEINLINE
+  auto erase(Key&& x) -> typename std::enable_if<
+    !std::is_convertible<Key,iterator>::value&&
+    !std::is_convertible<Key,const_iterator>::value&&
+    !std::is_convertible<Key,const_equal_range_iterator>::value,
+    std::size_t>::type
+  {
+    std::size_t s=size();
+    for(auto it=equal_range_first(x);it.p;){
+      auto pos=it++;
+      super::erase(pos.groups+pos.pb.get(),pos.n,pos.p);
+    }
+    return std::size_t(s-size());
+  }
+
+  void swap(multi_table& x)
+    noexcept(noexcept(std::declval<super&>().swap(std::declval<super&>())))
+  {
+    super::swap(x);
+  }
+
+  using super::clear;
+
+  element_type extract(const_iterator pos)
+  {
+    BOOST_ASSERT(pos!=end());
+    erase_on_exit e{*this,pos};
+    (void)e;
+    return std::move(*pos.p());
+  }
+
+  template<typename Hash2,typename Pred2>
+  void merge(multi_table<TypePolicy,Hash2,Pred2,Allocator>& x)
+  {
+    /* self-merge would move elements within the arrays being traversed */
+    if(static_cast<void*>(this)==static_cast<void*>(std::addressof(x)))return;
+
+    if(super::template transfer_layout_compatible<Hash2>(x.arrays,x.size())){
+      /* insertion is unconditional, so hash values need not be recalculated */
+      super::import_overflow(x.arrays);
+      x.for_all_elements([&,this](group_type* pg,unsigned int n,element_type* p){
+        erase_on_exit e{x,{pg,n,p}};
+        (void)e;
+        super::unchecked_transfer(x.arrays,pg,n,p);
+      });
+      return;
+    }
+
+    x.for_all_elements([&,this](group_type* pg,unsigned int n,element_type* p){
+      erase_on_exit e{x,{pg,n,p}};
+      (void)e;
+      emplace_impl(type_policy::move(*p));
+    });
+  }
+
+  template<typename Hash2,typename Pred2>
+  void merge(multi_table<TypePolicy,Hash2,Pred2,Allocator>&& x){merge(x);}
+
+  using super::hash_function;
+  using super::key_eq;
+
+  template<typename Key>
+  BOOST_FORCEINLINE iterator find(const Key& x)
+  {
+    return make_iterator(super::find(x));
+  }
+
+  template<typename Key>
+  BOOST_FORCEINLINE const_iterator find(const Key& x)const
+  {
+    return const_cast<multi_table*>(this)->find(x);
+  }
+
+  template<typename Key>
+  BOOST_FORCEINLINE std::size_t count(const Key& x)const
+  {
+    std::size_t res=0;
+    for(auto it=const_cast<multi_table*>(this)->equal_range_first(x);it.p;
+        it.increment()){
+      ++res;
+    }
+    return res;
+  }
+
+  template<typename Key>
+  BOOST_FORCEINLINE
+  std::pair<equal_range_iterator,equal_range_iterator>
+  equal_range(const Key& x)
+  {
+    return {equal_range_first(x),{}};
+  }
+
+  template<typename Key>
+  BOOST_FORCEINLINE
+  std::pair<const_equal_range_iterator,const_equal_range_iterator>
+  equal_range(const Key& x)const
+  {
+    return const_cast<multi_table*>(this)->equal_range(x);
+  }
+
+  using super::capacity;
+  using super::load_factor;
+  using super::max_load_factor;
+  using super::max_load;
+  using super::rehash;
+  using super::reserve;
+
+  template<typename Predicate>
+  friend std::size_t erase_if(multi_table& x,Predicate& pr)
+  {
+    using value_reference=typename std::conditional<
+      std::is_same<key_type,value_type>::value,
+      const_reference,
+      reference
+    >::type;
+
+    std::size_t s=x.size();
+    x.for_all_elements(
+      [&](group_type* pg,unsigned int n,element_type* p){
+        if(pr(const_cast<value_reference>(type_policy::value_from(*p)))){
+          x.super::erase(pg,n,p);
+        }
+      });
+    return std::size_t(s-x.size());
+  }
+
+  /* x==y iff for every element of x, the number of equal elements is the
+   * same in x and y. Cost is linear on size() times the average number of
+   * equivalent elements per key.
+   */
+
+  friend bool operator==(const multi_table& x,const multi_table& y)
+  {
+    return
+      x.size()==y.size()&&
+      x.for_all_elements_while([&](element_type* p){
+        const auto& v=
+          const_cast<const value_type&>(type_policy::value_from(*p));
+        return x.count_equal(v)==y.count_equal(v);
+      });
+  }
+
+  friend bool operator!=(const multi_table& x,const multi_table& y)
+  {
+    return !(x==y);
+  }
+
+private:
+  template<typename,typename,typename,typename> friend class multi_table;
+
+  struct erase_on_exit
+  {
+    erase_on_exit(multi_table& x_,const_iterator it_):x(x_),it(it_){}
+    ~erase_on_exit(){x.erase(it);}
+
+    multi_table&   x;
+    const_iterator it;
+  };
+
+  static inline iterator make_iterator(const locator& l)noexcept
+  {
+    return {l.pg,l.n,l.p};
+  }
+
+  template<typename Key>
+  BOOST_FORCEINLINE equal_range_iterator equal_range_first(const Key& x)
+  {
+    auto                 hash=this->hash_for(x);
+    equal_range_iterator it{
+      this->arrays.groups(),this->arrays.elements(),
+      this->arrays.groups_size_mask,this->pred(),
+      this->position_for(hash),hash};
+    it.find_first(x);
+    return it;
+  }
+
+  std::size_t count_equal(const value_type& v)const
+  {
+    std::size_t res=0;
+    for(auto it=const_cast<multi_table*>(this)->equal_range_first(
+          type_policy::extract(v));it.p;it.increment()){
+      if(const_cast<const value_type&>(*it)==v)++res;
+    }
+    return res;
+  }
+
+  template<typename... Args>
+  BOOST_FORCEINLINE iterator emplace_impl(Args&&... args)
+  {
+    const auto &k=this->key_from(std::forward<Args>(args)...);
+    auto        hash=this->hash_for(k);
+
+    if(BOOST_LIKELY(this->size_ctrl.size<this->size_ctrl.ml)){
+      return make_iterator(
+        this->unchecked_emplace_at(
+          this->position_for(hash),hash,std::forward<Args>(args)...));
+    }
+    else{
+      return make_iterator(
+        this->unchecked_emplace_with_rehash(
+          hash,std::forward<Args>(args)...));
+    }
+  }
+};
+
+#if defined(BOOST_MSVC)
+#pragma warning(pop) /* C4714 */
+#endif
+
+#include <boost/unordered/detail/foa/restore_wshadow.hpp>
+
+} /* namespace foa */
+} /* namespace detail */
+} /* namespace unordered */
+} /* namespace boost */
+
+#endif
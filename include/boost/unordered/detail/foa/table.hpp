@@ -16,7 +16,10 @@
 #include <boost/config.hpp>
 #include <boost/config/workaround.hpp>
 #include <boost/core/serialization.hpp>
+#include <boost/unordered/detail/archive_constructed.hpp>
 #include <boost/unordered/detail/foa/core.hpp>
+#include <boost/unordered/detail/incremental_checkpoints.hpp>
+#include <boost/unordered/detail/serialization_version.hpp>
 #include <boost/unordered/detail/serialize_tracked_address.hpp>
 #include <cstddef>
 #include <iterator>
@@ -57,6 +60,15 @@ struct plain_size_control
 template<typename,typename,typename,typename>
 class table;
 
+template<typename,typename,typename,typename>
+class multi_table;
+
+template<typename,typename,typename,bool>
+class table_equal_range_iterator;
+
+template<typename,typename,typename>
+class table_view;
+
 /* table_iterator keeps two pointers:
  * 
  *   - A pointer p to the element slot.
@@ -76,12 +88,17 @@ class table;
  * addresses rather than pointers).
  * 
  * p = nullptr is conventionally used to mark end() iterators.
+ *
+ * GroupStride is the distance between consecutive groups in sizeof(group)
+ * units, which is greater than one for interleaved_table_arrays.
  */
 
 /* internal conversion from const_iterator to iterator */
 struct const_iterator_cast_tag{}; 
 
-template<typename TypePolicy,typename GroupPtr,bool Const>
+template<
+  typename TypePolicy,typename GroupPtr,bool Const,std::size_t GroupStride=1
+>
 class table_iterator
 {
   using group_pointer_traits=boost::pointer_traits<GroupPtr>;
@@ -94,6 +111,9 @@ class table_iterator
     typename group_pointer_traits::template rebind<unsigned char>;
   static constexpr auto N=group_type::N;
   static constexpr auto regular_layout=group_type::regular_layout;
+  static constexpr std::size_t group_bytes=sizeof(group_type)*GroupStride;
+  static constexpr std::size_t element_stride=
+    GroupStride==1?N:group_bytes/sizeof(table_element_type);
 
 public:
   using difference_type=std::ptrdiff_t;
@@ -108,10 +128,12 @@ public:
 
   table_iterator():pc_{nullptr},p_{nullptr}{};
   template<bool Const2,typename std::enable_if<!Const2>::type* =nullptr>
-  table_iterator(const table_iterator<TypePolicy,GroupPtr,Const2>& x):
+  table_iterator(
+    const table_iterator<TypePolicy,GroupPtr,Const2,GroupStride>& x):
     pc_{x.pc_},p_{x.p_}{}
   table_iterator(
-    const_iterator_cast_tag, const table_iterator<TypePolicy,GroupPtr,true>& x):
+    const_iterator_cast_tag,
+    const table_iterator<TypePolicy,GroupPtr,true,GroupStride>& x):
     pc_{x.pc_},p_{x.p_}{}
 
   inline reference operator*()const noexcept
@@ -129,9 +151,13 @@ public:
     {return !(x==y);}
 
 private:
-  template<typename,typename,bool> friend class table_iterator;
+  template<typename,typename,bool,std::size_t> friend class table_iterator;
   template<typename> friend class table_erase_return_type;
   template<typename,typename,typename,typename> friend class table;
+  template<typename,typename,typename,typename> friend class multi_table;
+  template<typename,typename,typename,bool>
+  friend class table_equal_range_iterator;
+  template<typename,typename,typename> friend class table_view;
 
   table_iterator(group_type* pg,std::size_t n,const table_element_type* ptet):
     pc_{to_pointer<char_pointer>(
@@ -156,7 +182,8 @@ private:
     for(;;){
       ++p_;
       if(reinterpret_cast<uintptr_t>(pc())%sizeof(group_type)==N-1){
-        pc_+=static_cast<diff_type>(sizeof(group_type)-(N-1));
+        pc_+=static_cast<diff_type>(group_bytes-(N-1));
+        p_+=static_cast<diff_type>(element_stride-N);
         break;
       }
       ++pc_;
@@ -178,8 +205,8 @@ private:
         }
         return;
       }
-      pc_+=static_cast<diff_type>(sizeof(group_type));
-      p_+=static_cast<diff_type>(N);
+      pc_+=static_cast<diff_type>(group_bytes);
+      p_+=static_cast<diff_type>(element_stride);
     }
   }
 
@@ -195,8 +222,8 @@ private:
       reinterpret_cast<group_type*>(pc())->match_occupied()>>(n0+1))<<(n0+1);
     if(!mask){
       do{
-        pc_+=sizeof(group_type);
-        p_+=N;
+        pc_+=static_cast<diff_type>(group_bytes);
+        p_+=static_cast<diff_type>(element_stride);
       }
       while((mask=reinterpret_cast<group_type*>(pc())->match_occupied())==0);
     }
@@ -242,11 +269,14 @@ private:
 template<typename Iterator>
 class table_erase_return_type; 
 
-template<typename TypePolicy,typename GroupPtr,bool Const>
-class table_erase_return_type<table_iterator<TypePolicy,GroupPtr,Const>>
+template<
+  typename TypePolicy,typename GroupPtr,bool Const,std::size_t GroupStride
+>
+class table_erase_return_type<
+  table_iterator<TypePolicy,GroupPtr,Const,GroupStride>>
 {
-  using iterator=table_iterator<TypePolicy,GroupPtr,Const>;
-  using const_iterator=table_iterator<TypePolicy,GroupPtr,true>;
+  using iterator=table_iterator<TypePolicy,GroupPtr,Const,GroupStride>;
+  using const_iterator=table_iterator<TypePolicy,GroupPtr,true,GroupStride>;
 
 public:
   /* can't delete it because VS in pre-C++17 mode needs to see it for RVO */
@@ -267,6 +297,7 @@ public:
 
 private:
   template<typename,typename,typename,typename> friend class table;
+  template<typename,typename,typename,typename> friend class multi_table;
 
   table_erase_return_type(const_iterator pos_):pos{pos_}{}
   table_erase_return_type& operator=(const table_erase_return_type&)=delete;
@@ -300,14 +331,70 @@ private:
  * checking is done by boost::unordered_(flat|node)_(map|set).
  */
 
+BOOST_UNORDERED_INCREMENTAL_CHECKPOINTS_NAMESPACE_BEGIN
 template<typename,typename,typename,typename>
 class concurrent_table; /* concurrent/non-concurrent interop */
+BOOST_UNORDERED_INCREMENTAL_CHECKPOINTS_NAMESPACE_END
 
 template <typename TypePolicy,typename Hash,typename Pred,typename Allocator>
 using table_core_impl=
   table_core<TypePolicy,group15<plain_integral>,table_arrays,
   plain_size_control,Hash,Pred,Allocator>;
 
+/* table (but not multi_table) uses split_table_arrays when
+ * TypePolicy::split_keys is true and interleaved_table_arrays when
+ * TypePolicy::interleaved is true.
+ */
+
+template<typename TypePolicy,typename=void>
+struct has_split_keys:std::false_type{};
+
+template<typename TypePolicy>
+struct has_split_keys<TypePolicy,void_t<decltype(TypePolicy::split_keys)> >:
+  std::integral_constant<bool,TypePolicy::split_keys>{};
+
+template<typename TypePolicy,typename=void>
+struct has_interleaved_layout:std::false_type{};
+
+template<typename TypePolicy>
+struct has_interleaved_layout<
+  TypePolicy,void_t<decltype(TypePolicy::interleaved)> >:
+  std::integral_constant<bool,TypePolicy::interleaved>{};
+
+template<bool SplitKeys,bool Interleaved>
+struct table_arrays_for
+{
+  BOOST_UNORDERED_STATIC_ASSERT(!(SplitKeys&&Interleaved));
+
+  template<
+    typename Value,typename Group,typename SizePolicy,typename Allocator>
+  using type=table_arrays<Value,Group,SizePolicy,Allocator>;
+};
+
+template<>
+struct table_arrays_for<true,false>
+{
+  template<
+    typename Value,typename Group,typename SizePolicy,typename Allocator>
+  using type=split_table_arrays<Value,Group,SizePolicy,Allocator>;
+};
+
+template<>
+struct table_arrays_for<false,true>
+{
+  template<
+    typename Value,typename Group,typename SizePolicy,typename Allocator>
+  using type=interleaved_table_arrays<Value,Group,SizePolicy,Allocator>;
+};
+
+template <typename TypePolicy,typename Hash,typename Pred,typename Allocator>
+using unique_table_core_impl=
+  table_core<TypePolicy,group15<plain_integral>,
+  table_arrays_for<
+    has_split_keys<TypePolicy>::value,
+    has_interleaved_layout<TypePolicy>::value>::template type,
+  plain_size_control,Hash,Pred,Allocator>;
+
 #include <boost/unordered/detail/foa/ignore_wshadow.hpp>
 
 #if defined(BOOST_MSVC)
@@ -316,9 +403,9 @@ using table_core_impl=
 #endif
 
 template<typename TypePolicy,typename Hash,typename Pred,typename Allocator>
-class table:table_core_impl<TypePolicy,Hash,Pred,Allocator>
+class table:unique_table_core_impl<TypePolicy,Hash,Pred,Allocator>
 {
-  using super=table_core_impl<TypePolicy,Hash,Pred,Allocator>;
+  using super=unique_table_core_impl<TypePolicy,Hash,Pred,Allocator>;
   using type_policy=typename super::type_policy;
   using group_type=typename super::group_type;
   using super::N;
@@ -331,7 +418,7 @@ class table:table_core_impl<TypePolicy,Hash,Pred,Allocator>
   using group_type_pointer=typename boost::pointer_traits<
     typename boost::allocator_pointer<Allocator>::type
   >::template rebind<group_type>;
-  friend compatible_concurrent_table;
+  template<typename,typename,typename,typename> friend class concurrent_table;
 
 public:
   using key_type=typename super::key_type;
@@ -352,10 +439,11 @@ public:
   using const_reference=typename super::const_reference;
   using size_type=typename super::size_type;
   using difference_type=typename super::difference_type;
-  using const_iterator=table_iterator<type_policy,group_type_pointer,true>;
+  using const_iterator=table_iterator<
+    type_policy,group_type_pointer,true,super::group_stride>;
   using iterator=typename std::conditional<
     has_mutable_iterator,
-    table_iterator<type_policy,group_type_pointer,false>,
+    table_iterator<type_policy,group_type_pointer,false,super::group_stride>,
     const_iterator>::type;
   using erase_return_type=table_erase_return_type<iterator>;
 
@@ -486,6 +574,18 @@ public:
   template<typename Hash2,typename Pred2>
   void merge(table<TypePolicy,Hash2,Pred2,Allocator>& x)
   {
+    if(this->empty()&&std::is_same<Pred,Pred2>::value&&
+       super::template transfer_layout_compatible<Hash2>(x.arrays,x.size())){
+      /* no duplicates can arise, so skip lookup and hash recalculation */
+      super::import_overflow(x.arrays);
+      x.for_all_elements([&,this](group_type* pg,unsigned int n,element_type* p){
+        erase_on_exit e{x,{pg,n,p}};
+        (void)e;
+        super::unchecked_transfer(x.arrays,pg,n,p);
+      });
+      return;
+    }
+
     x.for_all_elements([&,this](group_type* pg,unsigned int n,element_type* p){
       erase_on_exit e{x,{pg,n,p}};
       if(!emplace_impl(type_policy::move(*p)).second)e.rollback();
@@ -516,6 +616,24 @@ public:
   using super::max_load;
   using super::rehash;
   using super::reserve;
+  using super::save_image;
+  using super::load_image;
+
+  template<typename Archive>
+  void save_layout(Archive& ar)const
+  {
+    save_layout(
+      ar,
+      std::integral_constant<bool,std::is_same<key_type,value_type>::value>{});
+  }
+
+  template<typename Archive>
+  void load_layout(Archive& ar)
+  {
+    load_layout(
+      ar,
+      std::integral_constant<bool,std::is_same<key_type,value_type>::value>{});
+  }
 
   template<typename Predicate>
   friend std::size_t erase_if(table& x,Predicate& pr)
@@ -548,17 +666,21 @@ private:
   table(compatible_concurrent_table&& x,arrays_holder<ArraysType,Allocator>&& ah):
     super{
       std::move(x.h()),std::move(x.pred()),std::move(x.al()),
-      [&x]{return arrays_type{
+      [&x]{return super::with_key_array(x.al(),arrays_type{
         x.arrays.groups_size_index,x.arrays.groups_size_mask,
         to_pointer<group_type_pointer>(
           reinterpret_cast<group_type*>(x.arrays.groups())),
-        x.arrays.elements_};},
+        x.arrays.elements_});},
       size_ctrl_type{x.size_ctrl.ml,x.size_ctrl.size}}
   {
+    /* concurrent tables don't support interleaved layouts */
+    BOOST_UNORDERED_STATIC_ASSERT(super::group_stride==1);
+
     compatible_concurrent_table::arrays_type::delete_group_access(x.al(),x.arrays);
     x.arrays=ah.release();
     x.size_ctrl.ml=x.initial_max_load();
     x.size_ctrl.size=0;
+    this->record_keys(this->arrays);
   }
 
   template<typename ExclusiveLockGuard>
@@ -583,6 +705,107 @@ private:
     return {l.pg,l.n,l.p};
   }
 
+  template<typename Archive>
+  void save_layout(Archive& ar,std::true_type /* set */)const
+  {
+    const serialization_version<value_type> value_version;
+
+    ar<<core::make_nvp("value_version",value_version);
+
+    super::save_layout(ar,[&](group_type* pg,unsigned int n,element_type* p){
+      auto& x=type_policy::value_from(*p);
+      core::save_construct_data_adl(ar,std::addressof(x),value_version);
+      ar<<core::make_nvp("item",x);
+      serialization_track(ar,const_iterator{pg,n,p});
+    });
+  }
+
+  template<typename Archive>
+  void save_layout(Archive& ar,std::false_type /* map */)const
+  {
+    using raw_key_type=typename std::remove_const<key_type>::type;
+    using raw_mapped_type=typename std::remove_const<
+      typename TypePolicy::mapped_type>::type;
+
+    const serialization_version<raw_key_type>    key_version;
+    const serialization_version<raw_mapped_type> mapped_version;
+
+    ar<<core::make_nvp("key_version",key_version);
+    ar<<core::make_nvp("mapped_version",mapped_version);
+
+    super::save_layout(ar,[&](group_type* pg,unsigned int n,element_type* p){
+      auto& x=type_policy::value_from(*p);
+      core::save_construct_data_adl(
+        ar,std::addressof(x.first),key_version);
+      ar<<core::make_nvp("key",x.first);
+      core::save_construct_data_adl(
+        ar,std::addressof(x.second),mapped_version);
+      ar<<core::make_nvp("mapped",x.second);
+      serialization_track(ar,const_iterator{pg,n,p});
+    });
+  }
+
+  template<typename Archive>
+  void load_layout(Archive& ar,std::true_type /* set */)
+  {
+    serialization_version<value_type> value_version;
+
+    ar>>core::make_nvp("value_version",value_version);
+
+    bool direct,check;
+    auto s=super::load_layout_arrays(ar,direct,check);
+    for(std::size_t n=0;n<s;++n){
+      std::size_t slot,hash;
+      ar>>core::make_nvp("slot",slot);
+      ar>>core::make_nvp("hash",hash);
+
+      archive_constructed<value_type> value("item",ar,value_version);
+      auto&                           x=value.get();
+      auto                            it=make_iterator(
+        this->unchecked_emplace_from_layout(
+          slot,hash,direct,
+          super::layout_check_for(check,n),
+          x,std::move(x)));
+      ar.reset_object_address(std::addressof(*it),std::addressof(x));
+      serialization_track(ar,it);
+    }
+  }
+
+  template<typename Archive>
+  void load_layout(Archive& ar,std::false_type /* map */)
+  {
+    using raw_key_type=typename std::remove_const<key_type>::type;
+    using raw_mapped_type=typename std::remove_const<
+      typename TypePolicy::mapped_type>::type;
+
+    serialization_version<raw_key_type>    key_version;
+    serialization_version<raw_mapped_type> mapped_version;
+
+    ar>>core::make_nvp("key_version",key_version);
+    ar>>core::make_nvp("mapped_version",mapped_version);
+
+    bool direct,check;
+    auto s=super::load_layout_arrays(ar,direct,check);
+    for(std::size_t n=0;n<s;++n){
+      std::size_t slot,hash;
+      ar>>core::make_nvp("slot",slot);
+      ar>>core::make_nvp("hash",hash);
+
+      archive_constructed<raw_key_type>    key("key",ar,key_version);
+      archive_constructed<raw_mapped_type> mapped("mapped",ar,mapped_version);
+      auto&                                k=key.get();
+      auto&                                m=mapped.get();
+      auto                                 it=make_iterator(
+        this->unchecked_emplace_from_layout(
+          slot,hash,direct,
+          super::layout_check_for(check,n),
+          k,std::move(k),std::move(m)));
+      ar.reset_object_address(std::addressof(it->first),std::addressof(k));
+      ar.reset_object_address(std::addressof(it->second),std::addressof(m));
+      serialization_track(ar,it);
+    }
+  }
+
   template<typename... Args>
   BOOST_FORCEINLINE std::pair<iterator,bool> emplace_impl(Args&&... args)
   {
@@ -0,0 +1,217 @@
+/* Read-only view of a binary image of a fast open-addressing hash table.
+ *
+ * Copyright 2026 agent.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See https://www.boost.org/libs/unordered for library home page.
+ */
+
+#ifndef BOOST_UNORDERED_DETAIL_FOA_TABLE_VIEW_HPP
+#define BOOST_UNORDERED_DETAIL_FOA_TABLE_VIEW_HPP
+
+#include <boost/config.hpp>
+#include <boost/core/empty_value.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/unordered/detail/bad_archive_exception.hpp>
+#include <boost/unordered/detail/foa/core.hpp>
+#include <boost/unordered/detail/foa/table.hpp>
+#include <boost/unordered/hash_traits.hpp>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace boost{
+namespace unordered{
+namespace detail{
+namespace foa{
+
+#include <boost/unordered/detail/foa/ignore_wshadow.hpp>
+
+/* table_view provides lookup and iteration over the binary image of a table
+ * (as written by table_core::save_image) residing in memory the view does not
+ * own, typically a memory-mapped file. Groups and elements are used in place,
+ * so the image must be aligned to sizeof(group_type) and outlive the view.
+ * Construction is O(1): apart from the header, only the sentinel and the
+ * elements involved in the sampled hash digest are inspected, and an image
+ * whose digest doesn't match the view's hash function is rejected, as
+ * elements can't be rehashed in read-only memory.
+ */
+
+template<typename TypePolicy,typename Hash,typename Pred>
+class table_view:empty_value<Hash,0>,empty_value<Pred,1>
+{
+  using hash_base=empty_value<Hash,0>;
+  using pred_base=empty_value<Pred,1>;
+  using type_policy=TypePolicy;
+  using group_type=group15<plain_integral>;
+  static constexpr auto N=group_type::N;
+  using size_policy=pow2_size_policy;
+  using prober=pow2_quadratic_prober;
+  using mix_policy=mix_policy_for<Hash>;
+  using element_type=typename type_policy::element_type;
+
+public:
+  using key_type=typename type_policy::key_type;
+  using value_type=typename type_policy::value_type;
+  using hasher=Hash;
+  using key_equal=Pred;
+  using size_type=std::size_t;
+  using difference_type=std::ptrdiff_t;
+  using const_iterator=table_iterator<type_policy,group_type*,true>;
+
+  table_view(const Hash& h_=Hash(),const Pred& pred_=Pred()):
+    hash_base{empty_init,h_},pred_base{empty_init,pred_}{}
+
+  table_view(
+    const void* data,std::size_t n,
+    const Hash& h_=Hash(),const Pred& pred_=Pred()):
+    hash_base{empty_init,h_},pred_base{empty_init,pred_}
+  {
+    BOOST_UNORDERED_STATIC_ASSERT(
+      is_trivially_copy_constructible<element_type>::value&&
+      std::is_trivially_destructible<element_type>::value);
+
+    table_image_header hd;
+    if(n<sizeof(hd))throw_exception(bad_archive_exception());
+    std::memcpy(&hd,data,sizeof(hd));
+    if(!hd.has_format<group_type,element_type>()||
+       hd.groups_size_index>=sizeof(std::size_t)*CHAR_BIT){
+      throw_exception(bad_archive_exception());
+    }
+    if(hd.groups_size_index==0){
+      if(hd.size!=0)throw_exception(bad_archive_exception());
+      return;
+    }
+
+    auto gsi=static_cast<std::size_t>(hd.groups_size_index);
+    auto groups_size=size_policy::size(gsi);
+    if(groups_size>
+         (n-sizeof(hd)+sizeof(element_type))/
+         (sizeof(group_type)+N*sizeof(element_type))||
+       hd.size>hd.ml||hd.ml>groups_size*N-1){
+      throw_exception(bad_archive_exception());
+    }
+
+    auto pc=static_cast<const unsigned char*>(data)+sizeof(hd);
+    auto pce=pc+groups_size*sizeof(group_type);
+    if(reinterpret_cast<uintptr_t>(pc)%sizeof(group_type)!=0||
+       reinterpret_cast<uintptr_t>(pce)%alignof(element_type)!=0){
+      throw_exception(bad_archive_exception());
+    }
+
+    groups_=reinterpret_cast<group_type*>(const_cast<unsigned char*>(pc));
+    elements_=reinterpret_cast<element_type*>(const_cast<unsigned char*>(pce));
+    if(!groups_[groups_size-1].is_sentinel(N-1)){
+      throw_exception(bad_archive_exception());
+    }
+    groups_size_index=gsi;
+    groups_size_mask=groups_size-1;
+    size_=static_cast<std::size_t>(hd.size);
+
+    if(sampled_hash_digest()!=hd.sampled_hash_digest){
+      throw_exception(bad_archive_exception());
+    }
+  }
+
+  const_iterator begin()const noexcept
+  {
+    const_iterator it{groups_,0,elements_};
+    if(elements_&&!(groups_[0].match_occupied()&0x1))++it;
+    return it;
+  }
+
+  const_iterator end()const noexcept{return {};}
+
+  bool        empty()const noexcept{return size_==0;}
+  std::size_t size()const noexcept{return size_;}
+
+  std::size_t capacity()const noexcept
+  {
+    return elements_?(groups_size_mask+1)*N-1:0;
+  }
+
+  float load_factor()const noexcept
+  {
+    if(capacity()==0)return 0;
+    else             return float(size())/float(capacity());
+  }
+
+  hasher    hash_function()const{return h();}
+  key_equal key_eq()const{return pred();}
+
+#if defined(BOOST_MSVC)
+/* warning: forcing value to bool 'true' or 'false' in bool(pred()...) */
+#pragma warning(push)
+#pragma warning(disable:4800)
+#endif
+
+  template<typename Key>
+  BOOST_FORCEINLINE const_iterator find(const Key& x)const
+  {
+    if(!elements_)return end();
+
+    auto   hash=mix_policy::mix(h(),x);
+    prober pb(size_policy::position(hash,groups_size_index));
+    do{
+      auto pos=pb.get();
+      auto pg=groups_+pos;
+      auto mask=pg->match(hash);
+      if(mask){
+        auto p=elements_+pos*N;
+        BOOST_UNORDERED_PREFETCH_ELEMENTS(p,N);
+        do{
+          auto n=unchecked_countr_zero(mask);
+          if(BOOST_LIKELY(bool(
+            pred()(lookup_key(x),type_policy::extract(p[n]))))){
+            return {pg,static_cast<std::size_t>(n),p+n};
+          }
+          mask&=mask-1;
+        }while(mask);
+      }
+      if(BOOST_LIKELY(pg->is_not_overflowed(hash))){
+        return end();
+      }
+    }
+    while(BOOST_LIKELY(pb.next(groups_size_mask)));
+    return end();
+  }
+
+#if defined(BOOST_MSVC)
+#pragma warning(pop) /* C4800 */
+#endif
+
+private:
+  const Hash& h()const{return hash_base::get();}
+  const Pred& pred()const{return pred_base::get();}
+
+  boost::uint64_t sampled_hash_digest()const
+  {
+    /* same as table_core::sampled_hash_digest */
+    boost::uint64_t fp=0;
+    std::size_t     n=table_image_header::digest_sample_size();
+    for(auto it=begin();it!=end()&&n!=0;++it,--n){
+      fp=table_image_header::combine_digest(
+        fp,mix_policy::mix(h(),type_policy::extract(*it)));
+    }
+    return fp;
+  }
+
+  group_type*   groups_=nullptr;
+  element_type* elements_=nullptr;
+  std::size_t   groups_size_index=0;
+  std::size_t   groups_size_mask=0;
+  std::size_t   size_=0;
+};
+
+#include <boost/unordered/detail/foa/restore_wshadow.hpp>
+
+} /* namespace foa */
+} /* namespace detail */
+} /* namespace unordered */
+} /* namespace boost */
+
+#endif
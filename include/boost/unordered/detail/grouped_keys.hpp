@@ -0,0 +1,30 @@
+// Copyright (C) 2026 agent
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNORDERED_DETAIL_GROUPED_KEYS_HPP
+#define BOOST_UNORDERED_DETAIL_GROUPED_KEYS_HPP
+
+#include <boost/config.hpp>
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#pragma once
+#endif
+
+// BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS changes the layout of the
+// nodes of closed-addressing containers and the code operating on them. When
+// defined, the containers, their nodes and their internal type descriptors
+// are declared in an inline namespace so that they're distinct types (with
+// distinct symbols) from those of translation units not defining the macro:
+// code shared between such translation units otherwise silently mixes both
+// layouts, whereas passing a container between them now fails to link.
+//
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+#define BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_BEGIN                           \
+  inline namespace grouped_keys {
+#define BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_END }
+#else
+#define BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_BEGIN
+#define BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_END
+#endif
+
+#endif // BOOST_UNORDERED_DETAIL_GROUPED_KEYS_HPP
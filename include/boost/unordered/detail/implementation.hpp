@@ -19,6 +19,7 @@
 #include <boost/unordered/detail/serialize_tracked_address.hpp>
 #include <boost/unordered/detail/static_assert.hpp>
 #include <boost/unordered/detail/type_traits.hpp>
+#include <boost/unordered/hash_traits.hpp>
 
 #include <boost/assert.hpp>
 #include <boost/core/allocator_traits.hpp>
@@ -1241,8 +1242,16 @@ namespace boost {
         template <class Key>
         iterator next_group(Key const& k, c_iterator n) const
         {
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+          if (n.p && n.p->group_size) {
+            c_iterator group_end(n.p->group_last, n.itb);
+            ++group_end;
+            return iterator(group_end.p, group_end.itb);
+          }
+#endif
           c_iterator last = this->end();
-          while (n != last && this->key_eq()(k, extractor::extract(*n))) {
+          while (n != last &&
+                 this->key_eq()(lookup_key(k), extractor::extract(*n))) {
             ++n;
           }
           return iterator(n.p, n.itb);
@@ -1253,14 +1262,18 @@ namespace boost {
           if (size_ == 0) {
             return 0;
           }
-          std::size_t c = 0;
           std::size_t const key_hash = this->hash(k);
           bucket_iterator itb = buckets_.at(buckets_.position(key_hash));
 
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+          node_pointer p = this->find_node_impl(k, itb);
+          return p ? p->group_size : 0;
+#else
+          std::size_t c = 0;
           bool found = false;
 
           for (node_pointer pos = itb->next; pos; pos = pos->next) {
-            if (this->key_eq()(k, this->get_key(pos))) {
+            if (this->key_eq()(lookup_key(k), this->get_key(pos))) {
               ++c;
               found = true;
             } else if (found) {
@@ -1268,6 +1281,7 @@ namespace boost {
             }
           }
           return c;
+#endif
         }
 
         node_allocator_type const& node_alloc() const
@@ -1476,6 +1490,9 @@ namespace boost {
           BOOST_ASSERT(buckets_.bucket_count() == src.buckets_.bucket_count());
 
           this->reserve(src.size_);
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+          node_pointer head = node_pointer();
+#endif
           for (iterator pos = src.begin(); pos != src.end(); ++pos) {
             node_tmp b(detail::func::construct_node(
                          this->node_alloc(), std::move(pos.p->value())),
@@ -1485,7 +1502,17 @@ namespace boost {
             std::size_t key_hash = this->hash(k);
 
             bucket_iterator itb = buckets_.at(buckets_.position(key_hash));
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+            // preserve the grouping of equivalent elements in src
+            if (pos.p->group_size) {
+              head = b.release();
+              buckets_.insert_node(itb, head);
+            } else {
+              buckets_.insert_node_hint(itb, b.release(), head);
+            }
+#else
             buckets_.insert_node(itb, b.release());
+#endif
             ++size_;
           }
         }
@@ -1675,20 +1702,31 @@ namespace boost {
 
         template <class Key> std::size_t hash(Key const& k) const
         {
-          return this->hash_function()(k);
+          return lookup_hash(this->hash_function(), k);
         }
 
         // Find Node
 
+        // Next node in the bucket whose key can differ from that of p
+        static node_pointer next_lookup_node(node_pointer p)
+        {
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+          return p->group_last->next;
+#else
+          return p->next;
+#endif
+        }
+
         template <class Key>
         node_pointer find_node_impl(Key const& x, bucket_iterator itb) const
         {
           node_pointer p = node_pointer();
           if (itb != buckets_.end()) {
             key_equal const& pred = this->key_eq();
+            auto const& k = lookup_key(x);
             p = itb->next;
-            for (; p; p = p->next) {
-              if (pred(x, extractor::extract(p->value()))) {
+            for (; p; p = next_lookup_node(p)) {
+              if (pred(k, extractor::extract(p->value()))) {
                 break;
               }
             }
@@ -1718,10 +1756,11 @@ namespace boost {
           Key const& k, Hash const& h, Pred const& pred) const
         {
           if (size_ > 0) {
-            std::size_t const key_hash = h(k);
+            std::size_t const key_hash = lookup_hash(h, k);
             bucket_iterator itb = buckets_.at(buckets_.position(key_hash));
-            for (node_pointer p = itb->next; p; p = p->next) {
-              if (BOOST_LIKELY(pred(k, extractor::extract(p->value())))) {
+            for (node_pointer p = itb->next; p; p = next_lookup_node(p)) {
+              if (BOOST_LIKELY(
+                    pred(lookup_key(k), extractor::extract(p->value())))) {
                 return iterator(p, itb);
               }
             }
@@ -1735,11 +1774,16 @@ namespace boost {
         {
           if (size_ > 0) {
             key_equal pred = this->key_eq();
-            for (node_pointer* pp = std::addressof(itb->next); *pp;
-                 pp = std::addressof((*pp)->next)) {
-              if (pred(key, extractor::extract((*pp)->value()))) {
+            auto const& k = lookup_key(key);
+            for (node_pointer* pp = std::addressof(itb->next); *pp;) {
+              if (pred(k, extractor::extract((*pp)->value()))) {
                 return pp;
               }
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+              pp = std::addressof((*pp)->group_last->next);
+#else
+              pp = std::addressof((*pp)->next);
+#endif
             }
           }
           typedef node_pointer* node_pointer_pointer;
@@ -1768,7 +1812,11 @@ namespace boost {
           const_key_type& key = extractor::extract(p->value());
           std::size_t const h = this->hash(key);
           bucket_iterator itnewb = new_buckets.at(new_buckets.position(h));
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+          new_buckets.insert_group(itnewb, p);
+#else
           new_buckets.insert_node(itnewb, p);
+#endif
         }
 
         static std::size_t min_buckets(std::size_t num_elements, float mlf)
@@ -2162,6 +2210,97 @@ namespace boost {
           }
         }
 
+        ////////////////////////////////////////////////////////////////////////
+        // Bulk insert
+        //
+        // Buckets are sized once for the whole range, then nodes are
+        // constructed and hashed in batches, sorted by bucket position and
+        // linked in that order so that consecutive writes to the bucket array
+        // are close to each other. If assume_unique is true, the range must
+        // not contain keys equivalent to each other or to those already in the
+        // table, and the duplicate check is skipped altogether.
+        //
+        // basic exception safety
+
+        struct bulk_insert_entry
+        {
+          std::size_t position;
+          std::size_t index;
+          node_pointer p;
+
+          bool operator<(bulk_insert_entry const& x) const
+          {
+            return position < x.position ||
+                   (position == x.position && index < x.index);
+          }
+        };
+
+        static const std::size_t bulk_insert_batch_size = 256;
+
+        template <class I>
+        typename boost::unordered::detail::enable_if_forward<I, void>::type
+        bulk_insert_unique(I i, I j, bool assume_unique)
+        {
+          if (i == j)
+            return;
+
+          this->reserve_for_insert(
+            size_ + static_cast<std::size_t>(std::distance(i, j)));
+
+          hasher const& hf = this->hash_function();
+          node_allocator_type alloc = this->node_alloc();
+          bulk_insert_entry batch[bulk_insert_batch_size];
+
+          while (i != j) {
+            std::size_t n = 0, m = 0;
+
+            BOOST_TRY
+            {
+              for (; n < bulk_insert_batch_size && i != j; ++i) {
+                node_tmp tmp(detail::func::construct_node(alloc, *i), alloc);
+                std::size_t const h = hf(this->get_key(tmp.node_));
+
+                batch[n].position = buckets_.position(h);
+                batch[n].index = n;
+                batch[n].p = tmp.release();
+                ++n;
+              }
+
+              std::sort(batch, batch + n);
+
+              for (; m < n; ++m) {
+                node_pointer p = batch[m].p;
+                bucket_iterator itb = buckets_.at(batch[m].position);
+                if (!assume_unique &&
+                    this->find_node_impl(this->get_key(p), itb)) {
+                  this->delete_node(p);
+                  continue;
+                }
+
+                buckets_.insert_node(itb, p);
+                ++size_;
+              }
+            }
+            BOOST_CATCH(...)
+            {
+              for (; m < n; ++m) {
+                this->delete_node(batch[m].p);
+              }
+              BOOST_RETHROW
+            }
+            BOOST_CATCH_END
+          }
+        }
+
+        template <class I>
+        typename boost::unordered::detail::disable_if_forward<I, void>::type
+        bulk_insert_unique(I i, I j, bool)
+        {
+          if (i != j) {
+            this->insert_range_unique(extractor::extract(*i), i, j);
+          }
+        }
+
         ////////////////////////////////////////////////////////////////////////
         // Extract
 
@@ -2200,13 +2339,7 @@ namespace boost {
           c_iterator next = pos;
           ++next;
 
-          bucket_iterator itb = pos.itb;
-          node_pointer* pp = std::addressof(itb->next);
-          while (*pp != pos.p) {
-            pp = std::addressof((*pp)->next);
-          }
-
-          buckets_.extract_node_after(itb, pp);
+          buckets_.extract_node(pos.itb, pos.p);
           this->delete_node(pos.p);
           --size_;
 
@@ -2225,13 +2358,28 @@ namespace boost {
           //
           bucket_iterator itb = first.itb;
           node_pointer* pp = std::addressof(itb->next);
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+          node_pointer prev = node_pointer(), head = node_pointer();
+          while (*pp != first.p) {
+            prev = *pp;
+            if (prev->group_size) {
+              head = prev;
+            }
+            pp = std::addressof(prev->next);
+          }
+#else
           while (*pp != first.p) {
             pp = std::addressof((*pp)->next);
           }
+#endif
 
           while (*pp != last.p) {
             node_pointer p = *pp;
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+            bucket_array_type::unlink_node(pp, prev, head);
+#else
             *pp = (*pp)->next;
+#endif
 
             this->delete_node(p);
             --size_;
@@ -2246,6 +2394,9 @@ namespace boost {
                 ++itb;
               }
               pp = std::addressof(itb->next);
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+              prev = head = node_pointer();
+#endif
             }
           }
 
@@ -2433,8 +2584,15 @@ namespace boost {
             key_hash = this->hash(k);
             itb = buckets_.at(buckets_.position(key_hash));
             p = this->find_node_impl(k, itb);
-          } else if (usable_hint && needs_rehash) {
-            key_hash = this->hash(k);
+          } else {
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+            if (!p->group_size) {
+              p = this->find_node_impl(k, itb);
+            }
+#endif
+            if (needs_rehash) {
+              key_hash = this->hash(k);
+            }
           }
 
           if (needs_rehash) {
@@ -2501,6 +2659,11 @@ namespace boost {
             }
 
             if (hint.p && this->key_eq()(k, this->get_key(hint.p))) {
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+              if (!pos->group_size) {
+                pos = this->find_node_impl(k, itb);
+              }
+#endif
             } else {
               itb = buckets_.at(buckets_.position(key_hash));
               pos = this->find_node_impl(k, itb);
@@ -2577,7 +2740,12 @@ namespace boost {
           bucket_iterator itb = buckets_.at(buckets_.position(this->hash(k)));
           node_pointer* pp = this->find_prev(k, itb);
           if (pp) {
-            while (*pp && this->key_eq()(this->get_key(*pp), k)) {
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
+            std::size_t const group_size = (*pp)->group_size;
+            while (deleted_count != group_size) {
+#else
+            while (*pp && this->key_eq()(this->get_key(*pp), lookup_key(k))) {
+#endif
               node_pointer p = *pp;
               *pp = (*pp)->next;
 
@@ -2601,6 +2769,34 @@ namespace boost {
         ////////////////////////////////////////////////////////////////////////
         // fill_buckets
 
+        // Equivalent elements are copied or moved from the source in runs of
+        // equal keys: the bucket and first node of the run last inserted are
+        // reused if the key compares equal, rather than hashing it and
+        // looking it up again, unless hashing is cheap and key comparison
+        // is not.
+
+        typedef std::integral_constant<bool,
+          !boost::unordered::hash_is_cheap<hasher>::value ||
+            boost::unordered::key_compare_is_cheap<key_equal>::value>
+          reuse_equiv_run;
+
+        node_pointer find_equiv_run(const_key_type& k, node_pointer run,
+          bucket_iterator& itb, std::true_type)
+        {
+          if (run && this->key_eq()(k, this->get_key(run))) {
+            return run;
+          }
+          return find_equiv_run(k, run, itb, std::false_type());
+        }
+
+        node_pointer find_equiv_run(const_key_type& k, node_pointer,
+          bucket_iterator& itb, std::false_type)
+        {
+          std::size_t const key_hash = this->hash(k);
+          itb = buckets_.at(buckets_.position(key_hash));
+          return this->find_node_impl(k, itb);
+        }
+
         void copy_buckets(table const& src, std::false_type)
         {
           BOOST_ASSERT(size_ == 0);
@@ -2608,16 +2804,19 @@ namespace boost {
           this->reserve_for_insert(src.size_);
 
           iterator last = src.end();
+          bucket_iterator itb = buckets_.end();
+          node_pointer run = node_pointer();
           for (iterator pos = src.begin(); pos != last; ++pos) {
             value_type const& value = *pos;
             const_key_type& key = extractor::extract(value);
-            std::size_t const key_hash = this->hash(key);
 
-            bucket_iterator itb = buckets_.at(buckets_.position(key_hash));
+            node_pointer hint =
+              this->find_equiv_run(key, run, itb, reuse_equiv_run());
             node_allocator_type alloc = this->node_alloc();
             node_tmp tmp(detail::func::construct_node(alloc, value), alloc);
-            node_pointer hint = this->find_node_impl(key, itb);
-            buckets_.insert_node_hint(itb, tmp.release(), hint);
+            node_pointer p = tmp.release();
+            buckets_.insert_node_hint(itb, p, hint);
+            run = hint ? hint : p;
             ++size_;
           }
         }
@@ -2629,19 +2828,21 @@ namespace boost {
 
           iterator last = src.end();
           node_allocator_type alloc = this->node_alloc();
+          bucket_iterator itb = buckets_.end();
+          node_pointer run = node_pointer();
 
           for (iterator pos = src.begin(); pos != last; ++pos) {
             value_type value = std::move(*pos);
             const_key_type& key = extractor::extract(value);
-            std::size_t const key_hash = this->hash(key);
-
-            bucket_iterator itb = buckets_.at(buckets_.position(key_hash));
 
-            node_pointer hint = this->find_node_impl(key, itb);
+            node_pointer hint =
+              this->find_equiv_run(key, run, itb, reuse_equiv_run());
             node_tmp tmp(
               detail::func::construct_node(alloc, std::move(value)), alloc);
 
-            buckets_.insert_node_hint(itb, tmp.release(), hint);
+            node_pointer p = tmp.release();
+            buckets_.insert_node_hint(itb, p, hint);
+            run = hint ? hint : p;
             ++size_;
           }
         }
@@ -2718,7 +2919,7 @@ namespace boost {
           for (; pos != last; ++pos) {
             bucket_type& b = *pos;
             for (node_pointer p = b.next; p;) {
-              node_pointer next_p = p->next;
+              node_pointer next_p = next_lookup_node(p);
               transfer_node(p, b, new_buckets);
               p = next_p;
               b.next = p;
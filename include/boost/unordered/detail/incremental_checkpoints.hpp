@@ -0,0 +1,29 @@
+// Copyright (C) 2026 agent
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNORDERED_DETAIL_INCREMENTAL_CHECKPOINTS_HPP
+#define BOOST_UNORDERED_DETAIL_INCREMENTAL_CHECKPOINTS_HPP
+
+#include <boost/config.hpp>
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#pragma once
+#endif
+
+// BOOST_UNORDERED_ENABLE_INCREMENTAL_CHECKPOINTS adds a dirty flag to the
+// per-group synchronization data of concurrent containers, set on every
+// exclusive group access, so as to support save_delta/apply_delta. As with
+// BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS, the containers and their
+// internals are then declared in an inline namespace so that translation
+// units disagreeing on the macro fail to link rather than mix layouts.
+//
+#if defined(BOOST_UNORDERED_ENABLE_INCREMENTAL_CHECKPOINTS)
+#define BOOST_UNORDERED_INCREMENTAL_CHECKPOINTS_NAMESPACE_BEGIN                \
+  inline namespace incremental_checkpoints {
+#define BOOST_UNORDERED_INCREMENTAL_CHECKPOINTS_NAMESPACE_END }
+#else
+#define BOOST_UNORDERED_INCREMENTAL_CHECKPOINTS_NAMESPACE_BEGIN
+#define BOOST_UNORDERED_INCREMENTAL_CHECKPOINTS_NAMESPACE_END
+#endif
+
+#endif // BOOST_UNORDERED_DETAIL_INCREMENTAL_CHECKPOINTS_HPP
@@ -10,6 +10,9 @@
 namespace boost {
   namespace unordered {
     namespace detail {
+      // see boost/unordered/detail/grouped_keys.hpp
+      BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_BEGIN
+
       template <typename A, typename K, typename M, typename H, typename P>
       struct map
       {
@@ -40,6 +43,8 @@ namespace boost {
         typedef boost::unordered::insert_return_type_map<iterator, node_type> insert_return_type;
       };
 
+      BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_END
+
       template <typename K, typename M, typename H, typename P, typename A>
       class instantiate_map
       {
@@ -118,6 +118,45 @@ inline std::size_t mulx( std::size_t x ) noexcept
 #endif
 }
 
+// Mixes the low 32 bits of x, for hash values with no more significant bits
+// (as is the case of std::size_t values converted from 32-bit integers):
+// the 64x64->128 multiplication of mulx64 is replaced with a 64-bit
+// multiplication whose high half is folded onto the low half
+
+inline std::size_t mulx_narrow( std::size_t x ) noexcept
+{
+#if defined(BOOST_UNORDERED_64B_ARCHITECTURE)
+
+    boost::uint64_t r = (boost::uint64_t)(boost::uint32_t)x * 0x9E3779B97F4A7C15ull;
+    return (std::size_t)( r ^ ( r >> 32 ) );
+
+#else /* 32 bits assumed */
+
+    return mulx32( x, 0xE817FB2Du );
+
+#endif
+}
+
+// Mixing dependent on a secret seed, for protection against keys crafted so
+// that their hash values collide after mixing: the seed is xored into x
+// and also determines the (odd, thus nonzero) multiplier
+
+inline std::size_t mulx_seeded( std::size_t x, boost::uint64_t seed ) noexcept
+{
+#if defined(BOOST_UNORDERED_64B_ARCHITECTURE)
+
+    return (std::size_t)mulx64(
+        (boost::uint64_t)x ^ seed, ( seed ^ 0x9E3779B97F4A7C15ull ) | 1u );
+
+#else /* 32 bits assumed */
+
+    return mulx32(
+        (boost::uint32_t)x ^ (boost::uint32_t)seed,
+        ( (boost::uint32_t)( seed >> 32 ) ^ 0xE817FB2Du ) | 1u );
+
+#endif
+}
+
 #ifdef BOOST_UNORDERED_64B_ARCHITECTURE
 #undef BOOST_UNORDERED_64B_ARCHITECTURE
 #endif
@@ -0,0 +1,299 @@
+/* Copyright 2026 agent.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See https://www.boost.org/libs/unordered for library home page.
+ */
+
+#ifndef BOOST_UNORDERED_DETAIL_SERIALIZE_COMPACT_HPP
+#define BOOST_UNORDERED_DETAIL_SERIALIZE_COMPACT_HPP
+
+#include <algorithm>
+#include <boost/config.hpp>
+#include <boost/core/serialization.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/unordered/detail/bad_archive_exception.hpp>
+#include <boost/unordered/detail/static_assert.hpp>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost{
+namespace unordered{
+namespace detail{
+
+/* Compact serialization of containers with arithmetic key and mapped types
+ * (bool excluded): entries are sorted by the bit pattern of their keys, and
+ * each key is written as the LEB128 varint of its difference with the
+ * previous one, followed by the mapped value as a varint (zigzag-encoded if
+ * signed) or verbatim if floating point. The resulting bytes are handed to
+ * the archive in chunks of around compact_chunk_size bytes with
+ * save_binary, so there's no per-entry archive overhead.
+ */
+
+struct compact_no_mapped{}; /* mapped type of sets */
+
+template<std::size_t Size> struct compact_uint;
+template<> struct compact_uint<1>{using type=boost::uint8_t;};
+template<> struct compact_uint<2>{using type=boost::uint16_t;};
+template<> struct compact_uint<4>{using type=boost::uint32_t;};
+template<> struct compact_uint<8>{using type=boost::uint64_t;};
+
+inline void compact_write_varint(
+  std::vector<unsigned char>& buf,boost::uint64_t x)
+{
+  while(x>=0x80){
+    buf.push_back(static_cast<unsigned char>(x|0x80));
+    x>>=7;
+  }
+  buf.push_back(static_cast<unsigned char>(x));
+}
+
+inline void compact_read_varint(
+  const unsigned char*& p,const unsigned char* last,boost::uint64_t& x)
+{
+  x=0;
+  for(unsigned int shift=0;;shift+=7){
+    if(p==last||shift>=64)throw_exception(bad_archive_exception());
+    boost::uint64_t b=*p++;
+    x|=(b&0x7F)<<shift;
+    if(!(b&0x80))return;
+  }
+}
+
+template<typename T>
+struct compact_codec
+{
+  BOOST_UNORDERED_STATIC_ASSERT(
+    std::is_arithmetic<T>::value&&!std::is_same<T,bool>::value);
+
+  static constexpr int                digits=sizeof(T)*CHAR_BIT;
+  static constexpr boost::uint64_t    mask=
+    digits==64?~boost::uint64_t(0):(boost::uint64_t(1)<<(digits%64))-1;
+  static constexpr unsigned int       tag=
+    static_cast<unsigned int>(sizeof(T))*4+
+    (std::is_floating_point<T>::value?2:std::is_signed<T>::value?1:0);
+
+  static boost::uint64_t to_bits(T x)
+  {
+    typename compact_uint<sizeof(T)>::type b;
+    std::memcpy(&b,&x,sizeof(T));
+    return b;
+  }
+
+  static T from_bits(boost::uint64_t x)
+  {
+    auto b=static_cast<typename compact_uint<sizeof(T)>::type>(x);
+    T    res;
+    std::memcpy(&res,&b,sizeof(T));
+    return res;
+  }
+
+  static void write(std::vector<unsigned char>& buf,T x)
+  {
+    write(buf,to_bits(x),std::is_floating_point<T>{},std::is_signed<T>{});
+  }
+
+  static T read(const unsigned char*& p,const unsigned char* last)
+  {
+    return from_bits(
+      read(p,last,std::is_floating_point<T>{},std::is_signed<T>{}));
+  }
+
+private:
+  template<typename IsSigned>
+  static void write(
+    std::vector<unsigned char>& buf,boost::uint64_t x,
+    std::true_type /* floating point */,IsSigned)
+  {
+    for(int n=0;n<digits;n+=8)buf.push_back(static_cast<unsigned char>(x>>n));
+  }
+
+  static void write(
+    std::vector<unsigned char>& buf,boost::uint64_t x,
+    std::false_type /* integral */,std::true_type /* signed */)
+  {
+    /* zigzag */
+    compact_write_varint(buf,((x<<1)^(0-(x>>(digits-1))))&mask);
+  }
+
+  static void write(
+    std::vector<unsigned char>& buf,boost::uint64_t x,
+    std::false_type /* integral */,std::false_type /* unsigned */)
+  {
+    compact_write_varint(buf,x);
+  }
+
+  template<typename IsSigned>
+  static boost::uint64_t read(
+    const unsigned char*& p,const unsigned char* last,
+    std::true_type /* floating point */,IsSigned)
+  {
+    if(last-p<static_cast<std::ptrdiff_t>(sizeof(T))){
+      throw_exception(bad_archive_exception());
+    }
+    boost::uint64_t x=0;
+    for(int n=0;n<digits;n+=8)x|=boost::uint64_t(*p++)<<n;
+    return x;
+  }
+
+  static boost::uint64_t read(
+    const unsigned char*& p,const unsigned char* last,
+    std::false_type /* integral */,std::true_type /* signed */)
+  {
+    boost::uint64_t x;
+    compact_read_varint(p,last,x);
+    if(x&~mask)throw_exception(bad_archive_exception());
+    return ((x>>1)^(0-(x&1)))&mask;
+  }
+
+  static boost::uint64_t read(
+    const unsigned char*& p,const unsigned char* last,
+    std::false_type /* integral */,std::false_type /* unsigned */)
+  {
+    boost::uint64_t x;
+    compact_read_varint(p,last,x);
+    if(x&~mask)throw_exception(bad_archive_exception());
+    return x;
+  }
+};
+
+template<>
+struct compact_codec<compact_no_mapped>
+{
+  static constexpr unsigned int tag=0;
+
+  static void write(std::vector<unsigned char>&,compact_no_mapped){}
+
+  static compact_no_mapped read(const unsigned char*&,const unsigned char*)
+  {
+    return {};
+  }
+};
+
+/* chunks are closed when reaching this size (an entry takes at most 20) */
+
+constexpr std::size_t compact_chunk_size=65536;
+
+struct compact_chunk
+{
+  std::vector<unsigned char>& buf;
+
+private:
+  friend class boost::serialization::access;
+
+  template<class Archive>
+  void serialize(Archive& ar,unsigned int version)
+  {
+    core::split_member(ar,*this,version);
+  }
+
+  template<class Archive>
+  void save(Archive& ar,unsigned int)const
+  {
+    const std::size_t n=buf.size();
+    ar<<core::make_nvp("size",n);
+    ar.save_binary(buf.data(),n);
+  }
+
+  template<class Archive>
+  void load(Archive& ar,unsigned int)
+  {
+    std::size_t n;
+    ar>>core::make_nvp("size",n);
+    if(n>compact_chunk_size+32)throw_exception(bad_archive_exception());
+    buf.resize(n);
+    ar.load_binary(buf.data(),n);
+  }
+};
+
+template<typename Archive,typename Key,typename Mapped>
+void save_compact_entries(
+  Archive& ar,std::vector<std::pair<Key,Mapped> >& entries)
+{
+  using key_codec=compact_codec<Key>;
+  using mapped_codec=compact_codec<Mapped>;
+
+  const std::size_t  s=entries.size();
+  const unsigned int key_tag=key_codec::tag,mapped_tag=mapped_codec::tag;
+
+  ar<<core::make_nvp("count",s);
+  ar<<core::make_nvp("key_type",key_tag);
+  ar<<core::make_nvp("mapped_type",mapped_tag);
+
+  std::sort(
+    entries.begin(),entries.end(),
+    [](const std::pair<Key,Mapped>& x,const std::pair<Key,Mapped>& y){
+      return key_codec::to_bits(x.first)<key_codec::to_bits(y.first);
+    });
+
+  std::vector<unsigned char> buf;
+  compact_chunk              chunk{buf};
+  boost::uint64_t            prev=0;
+  buf.reserve(compact_chunk_size+32);
+  for(std::size_t i=0;i<s;){
+    buf.clear();
+    for(;i<s&&buf.size()<compact_chunk_size;++i){
+      auto bits=key_codec::to_bits(entries[i].first);
+      compact_write_varint(buf,bits-prev);
+      mapped_codec::write(buf,entries[i].second);
+      prev=bits;
+    }
+    ar<<core::make_nvp("chunk",chunk);
+  }
+}
+
+/* r(s) is invoked with the number of entries before f(key,mapped) is
+ * invoked for each of them
+ */
+
+template<typename Key,typename Mapped,typename Archive,typename R,typename F>
+void load_compact_entries(Archive& ar,R r,F f)
+{
+  using key_codec=compact_codec<Key>;
+  using mapped_codec=compact_codec<Mapped>;
+
+  std::size_t  s;
+  unsigned int key_tag,mapped_tag;
+
+  ar>>core::make_nvp("count",s);
+  ar>>core::make_nvp("key_type",key_tag);
+  ar>>core::make_nvp("mapped_type",mapped_tag);
+  if(key_tag!=key_codec::tag||mapped_tag!=mapped_codec::tag){
+    throw_exception(bad_archive_exception());
+  }
+  r(s);
+
+  std::vector<unsigned char> buf;
+  compact_chunk              chunk{buf};
+  boost::uint64_t            prev=0;
+  for(std::size_t i=0;i<s;){
+    ar>>core::make_nvp("chunk",chunk);
+    const unsigned char *p=buf.data(),*last=p+buf.size();
+    if(p==last)throw_exception(bad_archive_exception());
+    for(;p!=last;++i){
+      boost::uint64_t delta;
+      compact_read_varint(p,last,delta);
+      auto bits=prev+delta;
+
+      /* keys are strictly increasing */
+      if(i>=s||(i!=0&&delta==0)||bits<prev||(bits&~key_codec::mask)){
+        throw_exception(bad_archive_exception());
+      }
+      auto k=key_codec::from_bits(bits);
+      f(k,mapped_codec::read(p,last));
+      prev=bits;
+    }
+  }
+}
+
+} /* namespace detail */
+} /* namespace unordered */
+} /* namespace boost */
+
+#endif
@@ -10,6 +10,9 @@
 namespace boost {
   namespace unordered {
     namespace detail {
+      // see boost/unordered/detail/grouped_keys.hpp
+      BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_BEGIN
+
       template <typename A, typename T, typename H, typename P> struct set
       {
         typedef boost::unordered::detail::set<A, T, H, P> types;
@@ -40,6 +43,8 @@ namespace boost {
           insert_return_type;
       };
 
+      BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_END
+
       template <typename T, typename H, typename P, typename A>
       class instantiate_set
       {
@@ -17,6 +17,7 @@
 #include <iterator>
 #endif
 
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -34,6 +35,8 @@
 
 namespace boost {
   namespace unordered {
+    template <class Key> class hashed_key;
+
     namespace detail {
 
       template <class T> struct type_identity
@@ -128,12 +131,79 @@ namespace boost {
       {
       };
 
-      template <class, class Hash, class KeyEqual> struct are_transparent
+      ////////////////////////////////////////////////////////////////////////////
+      // hashed_key<Key> (see <boost/unordered/hashed_key.hpp>) is accepted by
+      // lookup functions if the hash function and equality predicate are
+      // transparent or the hash function can take Key directly: the
+      // precomputed hash value is used instead of calling the hash function,
+      // and the wrapped key is passed to the predicate.
+
+      template <class Hash, class Key, class = void>
+      struct is_hash_invocable : std::false_type
+      {
+      };
+
+      template <class Hash, class Key>
+      struct is_hash_invocable<Hash, Key,
+        boost::unordered::detail::void_t<decltype(
+          std::declval<Hash const&>()(std::declval<Key const&>()))> >
+          : std::true_type
+      {
+      };
+
+      template <class T> struct is_hashed_key : std::false_type
       {
+      };
+
+      template <class Key>
+      struct is_hashed_key<boost::unordered::hashed_key<Key> > : std::true_type
+      {
+      };
+
+      template <class T, class Hash> struct is_hashed_key_for : std::false_type
+      {
+      };
+
+      template <class Key, class Hash>
+      struct is_hashed_key_for<boost::unordered::hashed_key<Key>, Hash>
+          : is_hash_invocable<Hash, Key>
+      {
+      };
+
+      template <class Key, class Hash, class KeyEqual> struct are_transparent
+      {
+        typedef typename std::remove_cv<
+          typename std::remove_reference<Key>::type>::type key_type;
+
         static bool const value =
-          is_transparent<Hash>::value && is_transparent<KeyEqual>::value;
+          (is_transparent<Hash>::value && is_transparent<KeyEqual>::value) ||
+          is_hashed_key_for<key_type, Hash>::value;
       };
 
+      template <class Key> inline Key const& lookup_key(Key const& k)
+      {
+        return k;
+      }
+
+      template <class Key>
+      inline Key const& lookup_key(boost::unordered::hashed_key<Key> const& k)
+      {
+        return k.key();
+      }
+
+      template <class Hash, class Key>
+      inline std::size_t lookup_hash(Hash const& h, Key const& k)
+      {
+        return h(k);
+      }
+
+      template <class Hash, class Key>
+      inline std::size_t lookup_hash(
+        Hash const&, boost::unordered::hashed_key<Key> const& k)
+      {
+        return k.hash();
+      }
+
       template <class Key, class UnorderedMap> struct transparent_non_iterable
       {
         typedef typename UnorderedMap::hasher hash;
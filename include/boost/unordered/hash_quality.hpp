@@ -0,0 +1,90 @@
+/* Runtime monitoring of the hash values of open-addressing containers.
+ *
+ * Copyright 2026 agent.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See https://www.boost.org/libs/unordered for library home page.
+ */
+
+#ifndef BOOST_UNORDERED_HASH_QUALITY_HPP
+#define BOOST_UNORDERED_HASH_QUALITY_HPP
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <atomic>
+#include <cstddef>
+
+namespace boost{
+namespace unordered{
+
+/* Statistics of the (mixed) hash values of the elements of an
+ * open-addressing container, gathered each time its bucket array is
+ * rehashed when BOOST_UNORDERED_ENABLE_HASH_QUALITY_MONITOR is defined.
+ * Positions are taken from the position_bits most significant bits of hash
+ * values and reduced hashes from the 8 least significant ones: bits not
+ * varying across elements are wasted, and elements not in their initial
+ * group (displaced) need longer probe sequences for lookup.
+ */
+
+struct hash_quality_report
+{
+  std::size_t size=0;
+  std::size_t groups=0;
+  std::size_t position_bits=0;
+  std::size_t constant_position_bits=0;
+  std::size_t constant_reduced_hash_bits=0;
+  std::size_t displaced=0;
+  std::size_t max_probe_length=0;
+
+  /* statistics are not significant for smaller containers */
+
+  static constexpr std::size_t min_size(){return 64;}
+
+  bool degenerate()const noexcept
+  {
+    return
+      size>=min_size()&&
+      (constant_position_bits!=0||constant_reduced_hash_bits!=0||
+       displaced*8>size);
+  }
+};
+
+using hash_quality_handler=void(*)(const hash_quality_report&);
+
+namespace detail{
+
+inline void default_hash_quality_handler(const hash_quality_report&)
+{
+  BOOST_ASSERT_MSG(
+    false,"degenerate hash values detected in Boost.Unordered container");
+}
+
+inline std::atomic<hash_quality_handler>& hash_quality_handler_storage()
+{
+  static std::atomic<hash_quality_handler> h{&default_hash_quality_handler};
+  return h;
+}
+
+} /* namespace detail */
+
+/* The handler is invoked for degenerate reports only, from the thread
+ * performing the rehash (with exclusive access for concurrent containers).
+ * A null handler disables reporting. Handlers must not throw.
+ */
+
+inline hash_quality_handler set_hash_quality_handler(hash_quality_handler h)
+{
+  return detail::hash_quality_handler_storage().exchange(h);
+}
+
+inline hash_quality_handler get_hash_quality_handler()
+{
+  return detail::hash_quality_handler_storage().load();
+}
+
+} /* namespace unordered */
+} /* namespace boost */
+
+#endif
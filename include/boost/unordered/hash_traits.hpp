@@ -11,11 +11,31 @@
 #ifndef BOOST_UNORDERED_HASH_TRAITS_HPP
 #define BOOST_UNORDERED_HASH_TRAITS_HPP
 
+#include <boost/container_hash/hash_fwd.hpp>
+#include <boost/cstdint.hpp>
 #include <boost/unordered/detail/type_traits.hpp>
+#include <cstddef>
+#include <functional>
 
 namespace boost{
 namespace unordered{
 
+/* Bit mixing applied by open-addressing containers to the values returned by
+ * non-avalanching hash functions:
+ *   - mulx: mulx over the full width of std::size_t.
+ *   - mulx32: mixing of the low 32 bits only with a 64-bit rather than
+ *     128-bit product, for hash functions whose results have no more
+ *     significant bits (values of 32-bit integral types converted to
+ *     std::size_t, for instance).
+ *   - xmx: xmx function (xorshift-multiply-xorshift), which needs no high
+ *     half of a multiplication.
+ *   - seeded_mulx: mulx with operands depending on the 64-bit value
+ *     returned by h.seed() for the hash object h, so that mixing can't be
+ *     predicted without knowing the seed (see boost::unordered::seeded_hash).
+ * On 32-bit architectures, mulx and mulx32 are the same.
+ */
+enum class hash_mixing{mulx,mulx32,xmx,seeded_mulx};
+
 namespace detail{
 
 template<typename Hash,typename=void>
@@ -26,6 +46,59 @@ struct hash_is_avalanching_impl<Hash,
   boost::unordered::detail::void_t<typename Hash::is_avalanching> >:
     std::true_type{};
 
+template<typename Hash,typename=void>
+struct hash_mixing_policy_impl:
+  std::integral_constant<hash_mixing,hash_mixing::mulx>{};
+
+template<typename Hash>
+struct hash_mixing_policy_impl<Hash,
+  boost::unordered::detail::void_t<decltype(Hash::mixing)> >:
+    std::integral_constant<hash_mixing,Hash::mixing>{};
+
+template<typename Hash,typename=void>
+struct hash_is_cheap_impl: std::false_type{};
+
+template<typename Hash>
+struct hash_is_cheap_impl<Hash,
+  boost::unordered::detail::void_t<typename Hash::is_cheap> >:
+    std::true_type{};
+
+template<typename Pred,typename=void>
+struct key_compare_is_cheap_impl: std::false_type{};
+
+template<typename Pred>
+struct key_compare_is_cheap_impl<Pred,
+  boost::unordered::detail::void_t<typename Pred::is_cheap> >:
+    std::true_type{};
+
+template<typename Hash,typename=void>
+struct hash_fingerprint_impl{};
+
+template<typename Hash>
+struct hash_fingerprint_impl<Hash,
+  boost::unordered::detail::void_t<
+    decltype(std::declval<const Hash&>().fingerprint())> >
+{
+  static boost::uint64_t get(const Hash& h)
+  {
+    return static_cast<boost::uint64_t>(h.fingerprint());
+  }
+};
+
+template<typename Hash>
+struct hash_batch_impl
+{
+  /* H=Hash makes the return type dependent so that SFINAE applies */
+
+  template<typename FwdIterator,typename H=Hash>
+  static auto apply(
+    const H& h,FwdIterator first,std::size_t n,std::size_t* out)->
+    decltype(h.hash_batch(first,n,out),void())
+  {
+    h.hash_batch(first,n,out);
+  }
+};
+
 } /* namespace detail */
 
 /* Each trait can be partially specialized by users for concrete hash functions
@@ -38,6 +111,81 @@ struct hash_is_avalanching_impl<Hash,
 template<typename Hash>
 struct hash_is_avalanching: detail::hash_is_avalanching_impl<Hash>::type{};
 
+/* hash_mixing_policy<Hash>::value is Hash::mixing if this static member
+ * is present, hash_mixing::mulx otherwise.
+ */
+template<typename Hash>
+struct hash_mixing_policy: detail::hash_mixing_policy_impl<Hash>{};
+
+/* hash_is_cheap<Hash>::value is true when the type Hash::is_cheap is
+ * present, false otherwise. A cheap hash function is one whose cost is
+ * small compared to that of a cache miss, so that containers rather save
+ * on memory accesses than on hash calculations. boost::hash<T> and
+ * std::hash<T> are cheap for scalar types T.
+ */
+template<typename Hash>
+struct hash_is_cheap: detail::hash_is_cheap_impl<Hash>::type{};
+
+template<typename T>
+struct hash_is_cheap<boost::hash<T> >: std::is_scalar<T>{};
+
+template<typename T>
+struct hash_is_cheap<std::hash<T> >: std::is_scalar<T>{};
+
+/* key_compare_is_cheap<Pred>::value is true when the type Pred::is_cheap is
+ * present, false otherwise, with the same meaning as hash_is_cheap for
+ * equality predicates. std::equal_to<T> is cheap for scalar types T.
+ */
+template<typename Pred>
+struct key_compare_is_cheap: detail::key_compare_is_cheap_impl<Pred>::type{};
+
+template<typename T>
+struct key_compare_is_cheap<std::equal_to<T> >: std::is_scalar<T>{};
+
+/* hash_fingerprint<Hash>::get(h) returns a 64-bit value identifying the
+ * function computed by h, so that hash objects with equal fingerprints
+ * produce the same hash values (for a seeded hash function, the fingerprint
+ * would typically be derived from the seed). The default implementation
+ * returns h.fingerprint() if this member function is present; otherwise,
+ * hash_fingerprint<Hash> has no get member.
+ */
+template<typename Hash>
+struct hash_fingerprint: detail::hash_fingerprint_impl<Hash>{};
+
+/* hash_batch<Hash>::apply(h,first,n,out) stores into out[i] the hash value
+ * h(x) of the i-th element x of the range [first,first+n), for use by bulk
+ * operations. Computing the hash values of a block of keys in one go allows
+ * for implementations exploiting SIMD or instruction-level parallelism.
+ * The default implementation invokes h.hash_batch(first,n,out) if this
+ * member function is present, and is otherwise not available.
+ */
+template<typename Hash>
+struct hash_batch: detail::hash_batch_impl<Hash>{};
+
+namespace detail{
+
+template<typename Hash,typename FwdIterator,typename=void>
+struct has_hash_batch: std::false_type{};
+
+template<typename Hash,typename FwdIterator>
+struct has_hash_batch<Hash,FwdIterator,
+  boost::unordered::detail::void_t<
+    decltype(hash_batch<Hash>::apply(
+      std::declval<const Hash&>(),std::declval<FwdIterator>(),
+      std::size_t(0),static_cast<std::size_t*>(nullptr)))> >:
+    std::true_type{};
+
+template<typename Hash,typename=void>
+struct has_hash_fingerprint: std::false_type{};
+
+template<typename Hash>
+struct has_hash_fingerprint<Hash,
+  boost::unordered::detail::void_t<
+    decltype(hash_fingerprint<Hash>::get(std::declval<const Hash&>()))> >:
+    std::true_type{};
+
+} /* namespace detail */
+
 } /* namespace unordered */
 } /* namespace boost */
 
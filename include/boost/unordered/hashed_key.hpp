@@ -0,0 +1,62 @@
+/* Lookup key with a precomputed hash value.
+ *
+ * Copyright 2026 agent.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See https://www.boost.org/libs/unordered for library home page.
+ */
+
+#ifndef BOOST_UNORDERED_HASHED_KEY_HPP
+#define BOOST_UNORDERED_HASHED_KEY_HPP
+
+#include <boost/unordered/detail/type_traits.hpp>
+#include <cstddef>
+#include <type_traits>
+
+namespace boost{
+namespace unordered{
+
+/* hashed_key<Key> holds a reference to a key and the value returned for it
+ * by a hash function, so that the key can be looked up in several
+ * containers with equivalent hash functions without rehashing it.
+ * Containers apply their post-mixing stage (if any) to the stored value,
+ * so the same hashed_key can be used with seeded_hash objects of different
+ * seeds. The wrapped key must outlive the hashed_key object.
+ */
+
+template<typename Key>
+class hashed_key
+{
+public:
+  template<
+    typename Hash,
+    typename std::enable_if<
+      !std::is_convertible<Hash,std::size_t>::value>::type* =nullptr
+  >
+  hashed_key(const Key& x,const Hash& h):hashed_key{x,h(x)}{}
+  hashed_key(const Key& x,std::size_t hash)noexcept:px{&x},hash_{hash}{}
+
+  const Key&  key()const noexcept{return *px;}
+  std::size_t hash()const noexcept{return hash_;}
+
+private:
+  const Key*  px;
+  std::size_t hash_;
+};
+
+template<typename Key,typename Hash>
+hashed_key<Key> make_hashed_key(const Key& x,const Hash& h)
+{
+  return {x,h};
+}
+
+} /* namespace unordered */
+
+using unordered::hashed_key;
+using unordered::make_hashed_key;
+
+} /* namespace boost */
+
+#endif
@@ -0,0 +1,144 @@
+/* Hash function adaptor with a random per-instance seed for mixing.
+ *
+ * Copyright 2026 agent.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See https://www.boost.org/libs/unordered for library home page.
+ */
+
+#ifndef BOOST_UNORDERED_SEEDED_HASH_HPP
+#define BOOST_UNORDERED_SEEDED_HASH_HPP
+
+#include <boost/config.hpp>
+#include <boost/core/empty_value.hpp>
+#include <boost/core/no_exceptions_support.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/unordered/detail/mulx.hpp>
+#include <boost/unordered/detail/type_traits.hpp>
+#include <boost/unordered/hash_traits.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <utility>
+
+namespace boost{
+namespace unordered{
+
+namespace detail{
+
+/* Seeds are obtained by mixing a process-wide random value with a counter,
+ * so that only the first seeded_hash constructed in the program has to
+ * access std::random_device. Should this fail, the clock and the address of
+ * a local variable provide some (weak) entropy.
+ */
+
+inline boost::uint64_t make_base_seed()
+{
+  boost::uint64_t seed=static_cast<boost::uint64_t>(
+    std::chrono::high_resolution_clock::now().time_since_epoch().count());
+  seed^=static_cast<boost::uint64_t>(
+    reinterpret_cast<boost::uintptr_t>(&seed));
+  BOOST_TRY{
+    std::random_device rd;
+    seed^=(static_cast<boost::uint64_t>(rd())<<32)^rd();
+  }
+  BOOST_CATCH(...){
+  }
+  BOOST_CATCH_END
+  return seed;
+}
+
+inline boost::uint64_t make_seed()
+{
+  static const boost::uint64_t        base=make_base_seed();
+  static std::atomic<boost::uint64_t> counter{0};
+
+  boost::uint64_t n=counter.fetch_add(1,std::memory_order_relaxed);
+  return mulx64(base^(n*0x9E3779B97F4A7C15ull),0xD1B54A32D192ED03ull);
+}
+
+template<typename Hash,typename=void>
+struct seeded_hash_transparent_base{};
+
+template<typename Hash>
+struct seeded_hash_transparent_base<Hash,
+  boost::unordered::detail::void_t<typename Hash::is_transparent> >
+{
+  using is_transparent=void;
+};
+
+} /* namespace detail */
+
+/* seeded_hash<Hash> computes the same hash values as Hash, and has
+ * open-addressing containers mix them with a seed drawn at random upon
+ * default construction (hash_mixing::seeded_mulx), so that positions of
+ * elements in the container can't be predicted from the keys alone. The
+ * seed travels with the hash object on copy, move and swap of the
+ * container, and is part of the fingerprint (if Hash has one) recorded in
+ * layout archives and images.
+ */
+
+template<typename Hash>
+class seeded_hash:
+  public detail::seeded_hash_transparent_base<Hash>,
+  private boost::empty_value<Hash,0>
+{
+  using hash_base=boost::empty_value<Hash,0>;
+
+public:
+  static constexpr hash_mixing mixing=hash_mixing::seeded_mulx;
+
+  seeded_hash():seeded_hash{Hash{}}{}
+  explicit seeded_hash(const Hash& h):
+    seeded_hash{h,detail::make_seed()}{}
+  seeded_hash(const Hash& h,boost::uint64_t seed):
+    hash_base{boost::empty_init_t{},h},seed_{seed}{}
+
+  template<typename Key>
+  auto operator()(const Key& x)const->decltype(std::declval<const Hash&>()(x))
+  {
+    return hash_function()(x);
+  }
+
+  template<typename FwdIterator,typename H=Hash>
+  auto hash_batch(FwdIterator first,std::size_t n,std::size_t* out)const->
+    decltype(
+      boost::unordered::hash_batch<H>::apply(
+        std::declval<const H&>(),first,n,out),void())
+  {
+    boost::unordered::hash_batch<H>::apply(hash_function(),first,n,out);
+  }
+
+  template<typename H=Hash>
+  auto fingerprint()const->
+    decltype(boost::unordered::hash_fingerprint<H>::get(
+      std::declval<const H&>()))
+  {
+    return detail::mulx64(
+      boost::unordered::hash_fingerprint<H>::get(hash_function())^seed_,
+      0x9E3779B97F4A7C15ull);
+  }
+
+  const Hash&     hash_function()const noexcept{return hash_base::get();}
+  boost::uint64_t seed()const noexcept{return seed_;}
+
+private:
+  boost::uint64_t seed_;
+};
+
+template<typename Hash>
+constexpr hash_mixing seeded_hash<Hash>::mixing;
+
+template<typename Hash>
+struct hash_is_cheap<seeded_hash<Hash> >: hash_is_cheap<Hash>{};
+
+} /* namespace unordered */
+
+using unordered::seeded_hash;
+
+} /* namespace boost */
+
+#endif
@@ -0,0 +1,174 @@
+/* Avalanching hash function for strings.
+ *
+ * Copyright 2026 agent.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See https://www.boost.org/libs/unordered for library home page.
+ */
+
+#ifndef BOOST_UNORDERED_STRING_HASH_HPP
+#define BOOST_UNORDERED_STRING_HASH_HPP
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/predef.h>
+#include <boost/unordered/detail/mulx.hpp>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+#include <string_view>
+#endif
+
+namespace boost{
+namespace unordered{
+
+namespace detail{
+
+/* Hashing in the style of wyhash/rapidhash: strings of up to 16 bytes are
+ * read as two (possibly overlapping) 64-bit words, and longer strings are
+ * consumed in 16-byte steps, or 48-byte steps along three independent lanes
+ * while more than 48 bytes remain. Each step folds two words with mulx64
+ * (the xor of the high and low halves of their 128-bit product). Words are
+ * read in native byte order, so hash values depend on endianness. There is
+ * no SIMD path: all steps are computed with scalar instructions.
+ */
+
+struct string_hash_impl
+{
+  static constexpr boost::uint64_t s0=0x2d358dccaa6c78a5ull,
+                                   s1=0x8bb84b93962eacc9ull,
+                                   s2=0x4b33a62ed433d4a3ull;
+
+  static inline boost::uint64_t read64(const unsigned char* p)noexcept
+  {
+    boost::uint64_t x;
+    std::memcpy(&x,p,sizeof(x));
+    return x;
+  }
+
+  static inline boost::uint64_t read32(const unsigned char* p)noexcept
+  {
+    boost::uint32_t x;
+    std::memcpy(&x,p,sizeof(x));
+    return x;
+  }
+
+  static inline boost::uint64_t hash(
+    const void* data,std::size_t n,boost::uint64_t seed)noexcept
+  {
+    auto            p=static_cast<const unsigned char*>(data);
+    boost::uint64_t a,b;
+
+    seed^=mulx64(seed^s0,s1)^n;
+    if(BOOST_LIKELY(n<=16)){
+      if(n>=4){
+        std::size_t d=(n&24)>>(n>>3); /* 0 for n<8, 4 otherwise */
+        a=(read32(p)<<32)|read32(p+n-4);
+        b=(read32(p+d)<<32)|read32(p+n-4-d);
+      }
+      else if(n>0){
+        a=(boost::uint64_t(p[0])<<56)|(boost::uint64_t(p[n>>1])<<32)|p[n-1];
+        b=0;
+      }
+      else a=b=0;
+    }
+    else{
+      std::size_t i=n;
+      if(BOOST_UNLIKELY(i>48)){
+        boost::uint64_t seed1=seed,seed2=seed;
+        do{
+          seed=mulx64(read64(p)^s0,read64(p+8)^seed);
+          seed1=mulx64(read64(p+16)^s1,read64(p+24)^seed1);
+          seed2=mulx64(read64(p+32)^s2,read64(p+40)^seed2);
+          p+=48;
+          i-=48;
+        }while(i>48);
+        seed^=seed1^seed2;
+      }
+      if(i>16){
+        seed=mulx64(read64(p)^s2,read64(p+8)^seed^s1);
+        if(i>32)seed=mulx64(read64(p+16)^s2,read64(p+24)^seed);
+      }
+
+      /* last 16 bytes, overlapping with those already processed */
+      a=read64(p+i-16);
+      b=read64(p+i-8);
+    }
+    return mulx64(mulx64(a^s1,b^seed)^s0^n,s1);
+  }
+
+  /* hash values also depend on endianness and the width of std::size_t */
+
+  static inline boost::uint64_t fingerprint(boost::uint64_t seed)noexcept
+  {
+    return mulx64(
+      seed^s2,
+      s0^(sizeof(std::size_t)*CHAR_BIT)^(BOOST_ENDIAN_BIG_BYTE?0x100:0));
+  }
+};
+
+} /* namespace detail */
+
+/* string_hash is avalanching, so FOA containers use it without
+ * post-mixing, and transparent, so that it can be used for heterogeneous
+ * lookup along with a transparent equality predicate.
+ */
+
+class string_hash
+{
+public:
+  using is_avalanching=void;
+  using is_transparent=void;
+
+  string_hash()=default;
+  explicit string_hash(boost::uint64_t seed)noexcept:seed_{seed}{}
+
+  template<typename Traits,typename Allocator>
+  std::size_t operator()(
+    const std::basic_string<char,Traits,Allocator>& x)const noexcept
+  {
+    return hash(x.data(),x.size());
+  }
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+  template<typename Traits>
+  std::size_t operator()(std::basic_string_view<char,Traits> x)const noexcept
+  {
+    return hash(x.data(),x.size());
+  }
+#endif
+
+  std::size_t operator()(const char* x)const noexcept
+  {
+    return hash(x,std::strlen(x));
+  }
+
+  boost::uint64_t seed()const noexcept{return seed_;}
+
+  boost::uint64_t fingerprint()const noexcept
+  {
+    return detail::string_hash_impl::fingerprint(seed_);
+  }
+
+private:
+  std::size_t hash(const char* p,std::size_t n)const noexcept
+  {
+    return static_cast<std::size_t>(
+      detail::string_hash_impl::hash(p,n,seed_));
+  }
+
+  boost::uint64_t seed_=0;
+};
+
+} /* namespace unordered */
+
+using unordered::string_hash;
+
+} /* namespace boost */
+
+#endif
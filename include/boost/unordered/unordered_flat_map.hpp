@@ -12,7 +12,9 @@
 
 #include <boost/unordered/concurrent_flat_map_fwd.hpp>
 #include <boost/unordered/detail/foa/flat_map_types.hpp>
+#include <boost/unordered/detail/foa/multi_table.hpp>
 #include <boost/unordered/detail/foa/table.hpp>
+#include <boost/unordered/detail/serialize_compact.hpp>
 #include <boost/unordered/detail/serialize_container.hpp>
 #include <boost/unordered/detail/type_traits.hpp>
 #include <boost/unordered/unordered_flat_map_fwd.hpp>
@@ -22,10 +24,12 @@
 #include <boost/throw_exception.hpp>
 
 #include <initializer_list>
+#include <iosfwd>
 #include <iterator>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace boost {
   namespace unordered {
@@ -654,6 +658,44 @@ namespace boost {
 
       void reserve(size_type n) { table_.reserve(n); }
 
+      /// Binary image
+      ///
+
+      void save_image(std::ostream& os) const { table_.save_image(os); }
+
+      void load_image(std::istream& is) { table_.load_image(is); }
+
+      /// Layout-preserving serialization
+      ///
+
+      template <class Archive> void save_layout(Archive& ar) const
+      {
+        table_.save_layout(ar);
+      }
+
+      template <class Archive> void load_layout(Archive& ar)
+      {
+        table_.load_layout(ar);
+      }
+
+      /// Compact serialization
+      ///
+
+      template <class Archive> void save_compact(Archive& ar) const
+      {
+        std::vector<std::pair<key_type, mapped_type> > entries(
+          this->begin(), this->end());
+        detail::save_compact_entries(ar, entries);
+      }
+
+      template <class Archive> void load_compact(Archive& ar)
+      {
+        this->clear();
+        detail::load_compact_entries<key_type, mapped_type>(
+          ar, [this](size_type n) { this->reserve(n); },
+          [this](key_type k, mapped_type m) { table_.emplace(k, m); });
+      }
+
       /// Observers
       ///
 
@@ -704,6 +746,464 @@ namespace boost {
       detail::serialize_container(ar, map, version);
     }
 
+    template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+    class unordered_flat_multimap
+    {
+      using map_types = detail::foa::flat_map_types<Key, T>;
+
+      using table_type = detail::foa::multi_table<map_types, Hash, KeyEqual,
+        typename boost::allocator_rebind<Allocator,
+          typename map_types::value_type>::type>;
+
+      table_type table_;
+
+      template <class K, class V, class H, class KE, class A>
+      bool friend operator==(
+        unordered_flat_multimap<K, V, H, KE, A> const& lhs,
+        unordered_flat_multimap<K, V, H, KE, A> const& rhs);
+
+      template <class K, class V, class H, class KE, class A, class Pred>
+      typename unordered_flat_multimap<K, V, H, KE, A>::size_type friend
+      erase_if(unordered_flat_multimap<K, V, H, KE, A>& set, Pred pred);
+
+    public:
+      using key_type = Key;
+      using mapped_type = T;
+      using value_type = typename map_types::value_type;
+      using init_type = typename map_types::init_type;
+      using size_type = std::size_t;
+      using difference_type = std::ptrdiff_t;
+      using hasher = typename boost::unordered::detail::type_identity<Hash>::type;
+      using key_equal = typename boost::unordered::detail::type_identity<KeyEqual>::type;
+      using allocator_type = typename boost::unordered::detail::type_identity<Allocator>::type;
+      using reference = value_type&;
+      using const_reference = value_type const&;
+      using pointer = typename boost::allocator_pointer<allocator_type>::type;
+      using const_pointer =
+        typename boost::allocator_const_pointer<allocator_type>::type;
+      using iterator = typename table_type::iterator;
+      using const_iterator = typename table_type::const_iterator;
+      using equal_range_iterator = typename table_type::equal_range_iterator;
+      using const_equal_range_iterator =
+        typename table_type::const_equal_range_iterator;
+
+      unordered_flat_multimap() : unordered_flat_multimap(0) {}
+
+      explicit unordered_flat_multimap(size_type n,
+        hasher const& h = hasher(), key_equal const& pred = key_equal(),
+        allocator_type const& a = allocator_type())
+          : table_(n, h, pred, a)
+      {
+      }
+
+      unordered_flat_multimap(size_type n, allocator_type const& a)
+          : unordered_flat_multimap(n, hasher(), key_equal(), a)
+      {
+      }
+
+      unordered_flat_multimap(
+        size_type n, hasher const& h, allocator_type const& a)
+          : unordered_flat_multimap(n, h, key_equal(), a)
+      {
+      }
+
+      template <class InputIterator>
+      unordered_flat_multimap(
+        InputIterator f, InputIterator l, allocator_type const& a)
+          : unordered_flat_multimap(
+              f, l, size_type(0), hasher(), key_equal(), a)
+      {
+      }
+
+      explicit unordered_flat_multimap(allocator_type const& a)
+          : unordered_flat_multimap(0, a)
+      {
+      }
+
+      template <class Iterator>
+      unordered_flat_multimap(Iterator first, Iterator last, size_type n = 0,
+        hasher const& h = hasher(), key_equal const& pred = key_equal(),
+        allocator_type const& a = allocator_type())
+          : unordered_flat_multimap(n, h, pred, a)
+      {
+        this->insert(first, last);
+      }
+
+      template <class Iterator>
+      unordered_flat_multimap(
+        Iterator first, Iterator last, size_type n, allocator_type const& a)
+          : unordered_flat_multimap(first, last, n, hasher(), key_equal(), a)
+      {
+      }
+
+      template <class Iterator>
+      unordered_flat_multimap(Iterator first, Iterator last, size_type n,
+        hasher const& h, allocator_type const& a)
+          : unordered_flat_multimap(first, last, n, h, key_equal(), a)
+      {
+      }
+
+      unordered_flat_multimap(unordered_flat_multimap const& other)
+          : table_(other.table_)
+      {
+      }
+
+      unordered_flat_multimap(
+        unordered_flat_multimap const& other, allocator_type const& a)
+          : table_(other.table_, a)
+      {
+      }
+
+      unordered_flat_multimap(unordered_flat_multimap&& other)
+        noexcept(std::is_nothrow_move_constructible<table_type>::value)
+          : table_(std::move(other.table_))
+      {
+      }
+
+      unordered_flat_multimap(
+        unordered_flat_multimap&& other, allocator_type const& al)
+          : table_(std::move(other.table_), al)
+      {
+      }
+
+      unordered_flat_multimap(std::initializer_list<value_type> ilist,
+        size_type n = 0, hasher const& h = hasher(),
+        key_equal const& pred = key_equal(),
+        allocator_type const& a = allocator_type())
+          : unordered_flat_multimap(ilist.begin(), ilist.end(), n, h, pred, a)
+      {
+      }
+
+      unordered_flat_multimap(
+        std::initializer_list<value_type> il, allocator_type const& a)
+          : unordered_flat_multimap(il, size_type(0), hasher(), key_equal(), a)
+      {
+      }
+
+      unordered_flat_multimap(std::initializer_list<value_type> init,
+        size_type n, allocator_type const& a)
+          : unordered_flat_multimap(init, n, hasher(), key_equal(), a)
+      {
+      }
+
+      unordered_flat_multimap(std::initializer_list<value_type> init,
+        size_type n, hasher const& h, allocator_type const& a)
+          : unordered_flat_multimap(init, n, h, key_equal(), a)
+      {
+      }
+
+      ~unordered_flat_multimap() = default;
+
+      unordered_flat_multimap& operator=(unordered_flat_multimap const& other)
+      {
+        table_ = other.table_;
+        return *this;
+      }
+
+      unordered_flat_multimap& operator=(unordered_flat_multimap&& other)
+        noexcept(
+          noexcept(std::declval<table_type&>() = std::declval<table_type&&>()))
+      {
+        table_ = std::move(other.table_);
+        return *this;
+      }
+
+      allocator_type get_allocator() const noexcept
+      {
+        return table_.get_allocator();
+      }
+
+      /// Iterators
+      ///
+
+      iterator begin() noexcept { return table_.begin(); }
+      const_iterator begin() const noexcept { return table_.begin(); }
+      const_iterator cbegin() const noexcept { return table_.cbegin(); }
+
+      iterator end() noexcept { return table_.end(); }
+      const_iterator end() const noexcept { return table_.end(); }
+      const_iterator cend() const noexcept { return table_.cend(); }
+
+      /// Capacity
+      ///
+
+      BOOST_ATTRIBUTE_NODISCARD bool empty() const noexcept
+      {
+        return table_.empty();
+      }
+
+      size_type size() const noexcept { return table_.size(); }
+
+      size_type max_size() const noexcept { return table_.max_size(); }
+
+      /// Modifiers
+      ///
+
+      void clear() noexcept { table_.clear(); }
+
+      template <class Ty>
+      BOOST_FORCEINLINE auto insert(Ty&& value)
+        -> decltype(table_.insert(std::forward<Ty>(value)))
+      {
+        return table_.insert(std::forward<Ty>(value));
+      }
+
+      BOOST_FORCEINLINE iterator insert(init_type&& value)
+      {
+        return table_.insert(std::move(value));
+      }
+
+      template <class Ty>
+      BOOST_FORCEINLINE auto insert(const_iterator, Ty&& value)
+        -> decltype(table_.insert(std::forward<Ty>(value)))
+      {
+        return table_.insert(std::forward<Ty>(value));
+      }
+
+      BOOST_FORCEINLINE iterator insert(const_iterator, init_type&& value)
+      {
+        return table_.insert(std::move(value));
+      }
+
+      template <class InputIterator>
+      BOOST_FORCEINLINE void insert(InputIterator first, InputIterator last)
+      {
+        for (auto pos = first; pos != last; ++pos) {
+          table_.emplace(*pos);
+        }
+      }
+
+      void insert(std::initializer_list<value_type> ilist)
+      {
+        this->insert(ilist.begin(), ilist.end());
+      }
+
+      template <class... Args>
+      BOOST_FORCEINLINE iterator emplace(Args&&... args)
+      {
+        return table_.emplace(std::forward<Args>(args)...);
+      }
+
+      template <class... Args>
+      BOOST_FORCEINLINE iterator emplace_hint(const_iterator, Args&&... args)
+      {
+        return table_.emplace(std::forward<Args>(args)...);
+      }
+
+      BOOST_FORCEINLINE typename table_type::erase_return_type erase(
+        iterator pos)
+      {
+        return table_.erase(pos);
+      }
+
+      BOOST_FORCEINLINE typename table_type::erase_return_type erase(
+        const_iterator pos)
+      {
+        return table_.erase(pos);
+      }
+
+      iterator erase(const_iterator first, const_iterator last)
+      {
+        while (first != last) {
+          this->erase(first++);
+        }
+        return iterator{detail::foa::const_iterator_cast_tag{}, last};
+      }
+
+      BOOST_FORCEINLINE size_type erase(key_type const& key)
+      {
+        return table_.erase(key);
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        detail::transparent_non_iterable<K, unordered_flat_multimap>::value,
+        size_type>::type
+      erase(K const& key)
+      {
+        return table_.erase(key);
+      }
+
+      void swap(unordered_flat_multimap& rhs) noexcept(
+        noexcept(std::declval<table_type&>().swap(std::declval<table_type&>())))
+      {
+        table_.swap(rhs.table_);
+      }
+
+      template <class H2, class P2>
+      void merge(unordered_flat_multimap<key_type, mapped_type, H2, P2,
+        allocator_type>& source)
+      {
+        table_.merge(source.table_);
+      }
+
+      template <class H2, class P2>
+      void merge(unordered_flat_multimap<key_type, mapped_type, H2, P2,
+        allocator_type>&& source)
+      {
+        table_.merge(std::move(source.table_));
+      }
+
+      /// Lookup
+      ///
+
+      BOOST_FORCEINLINE size_type count(key_type const& key) const
+      {
+        return table_.count(key);
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        detail::are_transparent<K, hasher, key_equal>::value, size_type>::type
+      count(K const& key) const
+      {
+        return table_.count(key);
+      }
+
+      BOOST_FORCEINLINE iterator find(key_type const& key)
+      {
+        return table_.find(key);
+      }
+
+      BOOST_FORCEINLINE const_iterator find(key_type const& key) const
+      {
+        return table_.find(key);
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        iterator>::type
+      find(K const& key)
+      {
+        return table_.find(key);
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        const_iterator>::type
+      find(K const& key) const
+      {
+        return table_.find(key);
+      }
+
+      BOOST_FORCEINLINE bool contains(key_type const& key) const
+      {
+        return this->find(key) != this->end();
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        bool>::type
+      contains(K const& key) const
+      {
+        return this->find(key) != this->end();
+      }
+
+      std::pair<equal_range_iterator, equal_range_iterator> equal_range(
+        key_type const& key)
+      {
+        return table_.equal_range(key);
+      }
+
+      std::pair<const_equal_range_iterator, const_equal_range_iterator>
+      equal_range(key_type const& key) const
+      {
+        return table_.equal_range(key);
+      }
+
+      template <class K>
+      typename std::enable_if<
+        detail::are_transparent<K, hasher, key_equal>::value,
+        std::pair<equal_range_iterator, equal_range_iterator> >::type
+      equal_range(K const& key)
+      {
+        return table_.equal_range(key);
+      }
+
+      template <class K>
+      typename std::enable_if<
+        detail::are_transparent<K, hasher, key_equal>::value,
+        std::pair<const_equal_range_iterator,
+          const_equal_range_iterator> >::type
+      equal_range(K const& key) const
+      {
+        return table_.equal_range(key);
+      }
+
+      /// Hash Policy
+      ///
+
+      size_type bucket_count() const noexcept { return table_.capacity(); }
+
+      float load_factor() const noexcept { return table_.load_factor(); }
+
+      float max_load_factor() const noexcept
+      {
+        return table_.max_load_factor();
+      }
+
+      void max_load_factor(float) {}
+
+      size_type max_load() const noexcept { return table_.max_load(); }
+
+      void rehash(size_type n) { table_.rehash(n); }
+
+      void reserve(size_type n) { table_.reserve(n); }
+
+      /// Observers
+      ///
+
+      hasher hash_function() const { return table_.hash_function(); }
+
+      key_equal key_eq() const { return table_.key_eq(); }
+    };
+
+    template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+    bool operator==(
+      unordered_flat_multimap<Key, T, Hash, KeyEqual, Allocator> const& lhs,
+      unordered_flat_multimap<Key, T, Hash, KeyEqual, Allocator> const& rhs)
+    {
+      return lhs.table_ == rhs.table_;
+    }
+
+    template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+    bool operator!=(
+      unordered_flat_multimap<Key, T, Hash, KeyEqual, Allocator> const& lhs,
+      unordered_flat_multimap<Key, T, Hash, KeyEqual, Allocator> const& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+    template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+    void swap(unordered_flat_multimap<Key, T, Hash, KeyEqual, Allocator>& lhs,
+      unordered_flat_multimap<Key, T, Hash, KeyEqual, Allocator>& rhs)
+      noexcept(noexcept(lhs.swap(rhs)))
+    {
+      lhs.swap(rhs);
+    }
+
+    template <class Key, class T, class Hash, class KeyEqual, class Allocator,
+      class Pred>
+    typename unordered_flat_multimap<Key, T, Hash, KeyEqual,
+      Allocator>::size_type
+    erase_if(unordered_flat_multimap<Key, T, Hash, KeyEqual, Allocator>& map,
+      Pred pred)
+    {
+      return erase_if(map.table_, pred);
+    }
+
+    template <class Archive, class Key, class T, class Hash, class KeyEqual,
+      class Allocator>
+    void serialize(Archive& ar,
+      unordered_flat_multimap<Key, T, Hash, KeyEqual, Allocator>& map,
+      unsigned int version)
+    {
+      detail::serialize_container(ar, map, version);
+    }
+
 #if defined(BOOST_MSVC)
 #pragma warning(pop) /* C4714 */
 #endif
@@ -792,6 +1292,89 @@ namespace boost {
     unordered_flat_map(std::initializer_list<std::pair<Key, T> >, std::size_t,
       Hash, Allocator) -> unordered_flat_map<std::remove_const_t<Key>, T,
       Hash, std::equal_to<std::remove_const_t<Key> >, Allocator>;
+
+    template <class InputIterator,
+      class Hash =
+        boost::hash<boost::unordered::detail::iter_key_t<InputIterator> >,
+      class Pred =
+        std::equal_to<boost::unordered::detail::iter_key_t<InputIterator> >,
+      class Allocator = std::allocator<
+        boost::unordered::detail::iter_to_alloc_t<InputIterator> >,
+      class = std::enable_if_t<detail::is_input_iterator_v<InputIterator> >,
+      class = std::enable_if_t<detail::is_hash_v<Hash> >,
+      class = std::enable_if_t<detail::is_pred_v<Pred> >,
+      class = std::enable_if_t<detail::is_allocator_v<Allocator> > >
+    unordered_flat_multimap(InputIterator, InputIterator,
+      std::size_t = boost::unordered::detail::foa::default_bucket_count,
+      Hash = Hash(), Pred = Pred(), Allocator = Allocator())
+      -> unordered_flat_multimap<boost::unordered::detail::iter_key_t<InputIterator>,
+        boost::unordered::detail::iter_val_t<InputIterator>, Hash, Pred,
+        Allocator>;
+
+    template <class Key, class T,
+      class Hash = boost::hash<std::remove_const_t<Key> >,
+      class Pred = std::equal_to<std::remove_const_t<Key> >,
+      class Allocator = std::allocator<std::pair<const Key, T> >,
+      class = std::enable_if_t<detail::is_hash_v<Hash> >,
+      class = std::enable_if_t<detail::is_pred_v<Pred> >,
+      class = std::enable_if_t<detail::is_allocator_v<Allocator> > >
+    unordered_flat_multimap(std::initializer_list<std::pair<Key, T> >,
+      std::size_t = boost::unordered::detail::foa::default_bucket_count,
+      Hash = Hash(), Pred = Pred(), Allocator = Allocator())
+      -> unordered_flat_multimap<std::remove_const_t<Key>, T, Hash, Pred,
+        Allocator>;
+
+    template <class InputIterator, class Allocator,
+      class = std::enable_if_t<detail::is_input_iterator_v<InputIterator> >,
+      class = std::enable_if_t<detail::is_allocator_v<Allocator> > >
+    unordered_flat_multimap(InputIterator, InputIterator, std::size_t, Allocator)
+      -> unordered_flat_multimap<boost::unordered::detail::iter_key_t<InputIterator>,
+        boost::unordered::detail::iter_val_t<InputIterator>,
+        boost::hash<boost::unordered::detail::iter_key_t<InputIterator> >,
+        std::equal_to<boost::unordered::detail::iter_key_t<InputIterator> >,
+        Allocator>;
+
+    template <class InputIterator, class Allocator,
+      class = std::enable_if_t<detail::is_input_iterator_v<InputIterator> >,
+      class = std::enable_if_t<detail::is_allocator_v<Allocator> > >
+    unordered_flat_multimap(InputIterator, InputIterator, Allocator)
+      -> unordered_flat_multimap<boost::unordered::detail::iter_key_t<InputIterator>,
+        boost::unordered::detail::iter_val_t<InputIterator>,
+        boost::hash<boost::unordered::detail::iter_key_t<InputIterator> >,
+        std::equal_to<boost::unordered::detail::iter_key_t<InputIterator> >,
+        Allocator>;
+
+    template <class InputIterator, class Hash, class Allocator,
+      class = std::enable_if_t<detail::is_hash_v<Hash> >,
+      class = std::enable_if_t<detail::is_input_iterator_v<InputIterator> >,
+      class = std::enable_if_t<detail::is_allocator_v<Allocator> > >
+    unordered_flat_multimap(
+      InputIterator, InputIterator, std::size_t, Hash, Allocator)
+      -> unordered_flat_multimap<boost::unordered::detail::iter_key_t<InputIterator>,
+        boost::unordered::detail::iter_val_t<InputIterator>, Hash,
+        std::equal_to<boost::unordered::detail::iter_key_t<InputIterator> >,
+        Allocator>;
+
+    template <class Key, class T, class Allocator,
+      class = std::enable_if_t<detail::is_allocator_v<Allocator> > >
+    unordered_flat_multimap(std::initializer_list<std::pair<Key, T> >, std::size_t,
+      Allocator) -> unordered_flat_multimap<std::remove_const_t<Key>, T,
+      boost::hash<std::remove_const_t<Key> >,
+      std::equal_to<std::remove_const_t<Key> >, Allocator>;
+
+    template <class Key, class T, class Allocator,
+      class = std::enable_if_t<detail::is_allocator_v<Allocator> > >
+    unordered_flat_multimap(std::initializer_list<std::pair<Key, T> >, Allocator)
+      -> unordered_flat_multimap<std::remove_const_t<Key>, T,
+        boost::hash<std::remove_const_t<Key> >,
+        std::equal_to<std::remove_const_t<Key> >, Allocator>;
+
+    template <class Key, class T, class Hash, class Allocator,
+      class = std::enable_if_t<detail::is_hash_v<Hash> >,
+      class = std::enable_if_t<detail::is_allocator_v<Allocator> > >
+    unordered_flat_multimap(std::initializer_list<std::pair<Key, T> >, std::size_t,
+      Hash, Allocator) -> unordered_flat_multimap<std::remove_const_t<Key>, T,
+      Hash, std::equal_to<std::remove_const_t<Key> >, Allocator>;
 #endif
 
   } // namespace unordered
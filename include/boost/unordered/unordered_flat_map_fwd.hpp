@@ -14,6 +14,7 @@
 #include <boost/container_hash/hash_fwd.hpp>
 #include <functional>
 #include <memory>
+#include <type_traits>
 
 namespace boost {
   namespace unordered {
@@ -22,6 +23,26 @@ namespace boost {
       class Allocator = std::allocator<std::pair<const Key, T> > >
     class unordered_flat_map;
 
+    // Specialize to std::true_type to have unordered_flat_map<Key, T> keep a
+    // copy of each key in a separate array used for lookup, so that mapped
+    // values are only accessed on a successful lookup. Key must be trivially
+    // copyable.
+    //
+    template <class Key, class T>
+    struct flat_map_split_layout : std::false_type
+    {
+    };
+
+    // Specialize to std::true_type to have unordered_flat_map<Key, T> place
+    // the slots of each group right after its metadata rather than in a
+    // separate array. Intended for small key/mapped types, alignof(
+    // std::pair<const Key, T>) must not exceed 16.
+    //
+    template <class Key, class T>
+    struct flat_map_interleaved_layout : std::false_type
+    {
+    };
+
     template <class Key, class T, class Hash, class KeyEqual, class Allocator>
     bool operator==(
       unordered_flat_map<Key, T, Hash, KeyEqual, Allocator> const& lhs,
@@ -36,9 +57,32 @@ namespace boost {
     void swap(unordered_flat_map<Key, T, Hash, KeyEqual, Allocator>& lhs,
       unordered_flat_map<Key, T, Hash, KeyEqual, Allocator>& rhs)
       noexcept(noexcept(lhs.swap(rhs)));
+
+    template <class Key, class T, class Hash = boost::hash<Key>,
+      class KeyEqual = std::equal_to<Key>,
+      class Allocator = std::allocator<std::pair<const Key, T> > >
+    class unordered_flat_multimap;
+
+    template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+    bool operator==(
+      unordered_flat_multimap<Key, T, Hash, KeyEqual, Allocator> const& lhs,
+      unordered_flat_multimap<Key, T, Hash, KeyEqual, Allocator> const& rhs);
+
+    template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+    bool operator!=(
+      unordered_flat_multimap<Key, T, Hash, KeyEqual, Allocator> const& lhs,
+      unordered_flat_multimap<Key, T, Hash, KeyEqual, Allocator> const& rhs);
+
+    template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+    void swap(unordered_flat_multimap<Key, T, Hash, KeyEqual, Allocator>& lhs,
+      unordered_flat_multimap<Key, T, Hash, KeyEqual, Allocator>& rhs)
+      noexcept(noexcept(lhs.swap(rhs)));
   } // namespace unordered
 
+  using boost::unordered::flat_map_interleaved_layout;
+  using boost::unordered::flat_map_split_layout;
   using boost::unordered::unordered_flat_map;
+  using boost::unordered::unordered_flat_multimap;
 } // namespace boost
 
 #endif
@@ -14,6 +14,7 @@
 #include <boost/container_hash/hash_fwd.hpp>
 #include <functional>
 #include <memory>
+#include <type_traits>
 
 namespace boost {
   namespace unordered {
@@ -22,6 +23,15 @@ namespace boost {
       class Allocator = std::allocator<Key> >
     class unordered_flat_set;
 
+    // Specialize to std::true_type to have unordered_flat_set<Key> place the
+    // slots of each group right after its metadata rather than in a separate
+    // array. Intended for small key types, alignof(Key) must not exceed 16.
+    //
+    template <class Key>
+    struct flat_set_interleaved_layout : std::false_type
+    {
+    };
+
     template <class Key, class Hash, class KeyEqual, class Allocator>
     bool operator==(
       unordered_flat_set<Key, Hash, KeyEqual, Allocator> const& lhs,
@@ -36,9 +46,31 @@ namespace boost {
     void swap(unordered_flat_set<Key, Hash, KeyEqual, Allocator>& lhs,
       unordered_flat_set<Key, Hash, KeyEqual, Allocator>& rhs)
       noexcept(noexcept(lhs.swap(rhs)));
+
+    template <class Key, class Hash = boost::hash<Key>,
+      class KeyEqual = std::equal_to<Key>,
+      class Allocator = std::allocator<Key> >
+    class unordered_flat_multiset;
+
+    template <class Key, class Hash, class KeyEqual, class Allocator>
+    bool operator==(
+      unordered_flat_multiset<Key, Hash, KeyEqual, Allocator> const& lhs,
+      unordered_flat_multiset<Key, Hash, KeyEqual, Allocator> const& rhs);
+
+    template <class Key, class Hash, class KeyEqual, class Allocator>
+    bool operator!=(
+      unordered_flat_multiset<Key, Hash, KeyEqual, Allocator> const& lhs,
+      unordered_flat_multiset<Key, Hash, KeyEqual, Allocator> const& rhs);
+
+    template <class Key, class Hash, class KeyEqual, class Allocator>
+    void swap(unordered_flat_multiset<Key, Hash, KeyEqual, Allocator>& lhs,
+      unordered_flat_multiset<Key, Hash, KeyEqual, Allocator>& rhs)
+      noexcept(noexcept(lhs.swap(rhs)));
   } // namespace unordered
 
+  using boost::unordered::flat_set_interleaved_layout;
   using boost::unordered::unordered_flat_set;
+  using boost::unordered::unordered_flat_multiset;
 } // namespace boost
 
 #endif
@@ -35,6 +35,8 @@
 
 namespace boost {
   namespace unordered {
+    BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_BEGIN
+
     template <class K, class T, class H, class P, class A> class unordered_map
     {
       template <typename, typename, typename, typename, typename>
@@ -248,6 +250,9 @@ namespace boost {
 
       void insert(std::initializer_list<value_type>);
 
+      template <class InputIt>
+      void bulk_insert(InputIt, InputIt, bool assume_unique = false);
+
       // extract
 
       node_type extract(const_iterator position)
@@ -1222,7 +1227,7 @@ namespace boost {
       const allocator_type& a)
         : table_(boost::unordered::detail::initial_size(f, l, n), hf, eql, a)
     {
-      this->insert(f, l);
+      table_.bulk_insert_unique(f, l, false);
     }
 
     template <class K, class T, class H, class P, class A>
@@ -1294,7 +1299,7 @@ namespace boost {
                    f, l, detail::default_bucket_count),
             hasher(), key_equal(), a)
     {
-      this->insert(f, l);
+      table_.bulk_insert_unique(f, l, false);
     }
 
     template <class K, class T, class H, class P, class A>
@@ -1304,7 +1309,7 @@ namespace boost {
         : table_(boost::unordered::detail::initial_size(f, l, n), hasher(),
             key_equal(), a)
     {
-      this->insert(f, l);
+      table_.bulk_insert_unique(f, l, false);
     }
 
     template <class K, class T, class H, class P, class A>
@@ -1314,7 +1319,7 @@ namespace boost {
         : table_(
             boost::unordered::detail::initial_size(f, l, n), hf, key_equal(), a)
     {
-      this->insert(f, l);
+      table_.bulk_insert_unique(f, l, false);
     }
 
     template <class K, class T, class H, class P, class A>
@@ -1396,6 +1401,14 @@ namespace boost {
       this->insert(list.begin(), list.end());
     }
 
+    template <class K, class T, class H, class P, class A>
+    template <class InputIt>
+    void unordered_map<K, T, H, P, A>::bulk_insert(
+      InputIt first, InputIt last, bool assume_unique)
+    {
+      table_.bulk_insert_unique(first, last, assume_unique);
+    }
+
     template <class K, class T, class H, class P, class A>
     typename unordered_map<K, T, H, P, A>::iterator
     unordered_map<K, T, H, P, A>::erase(iterator position)
@@ -2325,6 +2338,8 @@ namespace boost {
       boost::core::invoke_swap(x.inserted, y.inserted);
       boost::core::invoke_swap(x.position, y.position);
     }
+
+    BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_END
   } // namespace unordered
 
   namespace serialization {
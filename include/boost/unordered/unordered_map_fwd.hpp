@@ -13,11 +13,14 @@
 #endif
 
 #include <boost/container_hash/hash_fwd.hpp>
+#include <boost/unordered/detail/grouped_keys.hpp>
 #include <functional>
 #include <memory>
 
 namespace boost {
   namespace unordered {
+    BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_BEGIN
+
     template <class K, class T, class H = boost::hash<K>,
       class P = std::equal_to<K>,
       class A = std::allocator<std::pair<const K, T> > >
@@ -58,6 +61,8 @@ namespace boost {
 
     template <class N, class K, class T, class A> class node_handle_map;
     template <class Iter, class NodeType> struct insert_return_type_map;
+
+    BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_END
   } // namespace unordered
 
   using boost::unordered::unordered_map;
@@ -36,9 +36,30 @@ namespace boost {
     void swap(unordered_node_map<Key, T, Hash, KeyEqual, Allocator>& lhs,
       unordered_node_map<Key, T, Hash, KeyEqual, Allocator>& rhs)
       noexcept(noexcept(lhs.swap(rhs)));
+
+    template <class Key, class T, class Hash = boost::hash<Key>,
+      class KeyEqual = std::equal_to<Key>,
+      class Allocator = std::allocator<std::pair<const Key, T> > >
+    class unordered_node_multimap;
+
+    template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+    bool operator==(
+      unordered_node_multimap<Key, T, Hash, KeyEqual, Allocator> const& lhs,
+      unordered_node_multimap<Key, T, Hash, KeyEqual, Allocator> const& rhs);
+
+    template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+    bool operator!=(
+      unordered_node_multimap<Key, T, Hash, KeyEqual, Allocator> const& lhs,
+      unordered_node_multimap<Key, T, Hash, KeyEqual, Allocator> const& rhs);
+
+    template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+    void swap(unordered_node_multimap<Key, T, Hash, KeyEqual, Allocator>& lhs,
+      unordered_node_multimap<Key, T, Hash, KeyEqual, Allocator>& rhs)
+      noexcept(noexcept(lhs.swap(rhs)));
   } // namespace unordered
 
   using boost::unordered::unordered_node_map;
+  using boost::unordered::unordered_node_multimap;
 } // namespace boost
 
 #endif
@@ -36,9 +36,30 @@ namespace boost {
     void swap(unordered_node_set<Key, Hash, KeyEqual, Allocator>& lhs,
       unordered_node_set<Key, Hash, KeyEqual, Allocator>& rhs)
       noexcept(noexcept(lhs.swap(rhs)));
+
+    template <class Key, class Hash = boost::hash<Key>,
+      class KeyEqual = std::equal_to<Key>,
+      class Allocator = std::allocator<Key> >
+    class unordered_node_multiset;
+
+    template <class Key, class Hash, class KeyEqual, class Allocator>
+    bool operator==(
+      unordered_node_multiset<Key, Hash, KeyEqual, Allocator> const& lhs,
+      unordered_node_multiset<Key, Hash, KeyEqual, Allocator> const& rhs);
+
+    template <class Key, class Hash, class KeyEqual, class Allocator>
+    bool operator!=(
+      unordered_node_multiset<Key, Hash, KeyEqual, Allocator> const& lhs,
+      unordered_node_multiset<Key, Hash, KeyEqual, Allocator> const& rhs);
+
+    template <class Key, class Hash, class KeyEqual, class Allocator>
+    void swap(unordered_node_multiset<Key, Hash, KeyEqual, Allocator>& lhs,
+      unordered_node_multiset<Key, Hash, KeyEqual, Allocator>& rhs)
+      noexcept(noexcept(lhs.swap(rhs)));
   } // namespace unordered
 
   using boost::unordered::unordered_node_set;
+  using boost::unordered::unordered_node_multiset;
 } // namespace boost
 
 #endif
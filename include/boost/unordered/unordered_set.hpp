@@ -35,6 +35,8 @@
 
 namespace boost {
   namespace unordered {
+    BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_BEGIN
+
     template <class T, class H, class P, class A> class unordered_set
     {
       template <typename, typename, typename, typename>
@@ -247,6 +249,9 @@ namespace boost {
 
       void insert(std::initializer_list<value_type>);
 
+      template <class InputIt>
+      void bulk_insert(InputIt, InputIt, bool assume_unique = false);
+
       // extract
 
       node_type extract(const_iterator position)
@@ -1014,7 +1019,7 @@ namespace boost {
       const hasher& hf, const key_equal& eql, const allocator_type& a)
         : table_(boost::unordered::detail::initial_size(f, l, n), hf, eql, a)
     {
-      this->insert(f, l);
+      table_.bulk_insert_unique(f, l, false);
     }
 
     template <class T, class H, class P, class A>
@@ -1086,7 +1091,7 @@ namespace boost {
                    f, l, detail::default_bucket_count),
             hasher(), key_equal(), a)
     {
-      this->insert(f, l);
+      table_.bulk_insert_unique(f, l, false);
     }
 
     template <class T, class H, class P, class A>
@@ -1096,7 +1101,7 @@ namespace boost {
         : table_(boost::unordered::detail::initial_size(f, l, n), hasher(),
             key_equal(), a)
     {
-      this->insert(f, l);
+      table_.bulk_insert_unique(f, l, false);
     }
 
     template <class T, class H, class P, class A>
@@ -1106,7 +1111,7 @@ namespace boost {
         : table_(
             boost::unordered::detail::initial_size(f, l, n), hf, key_equal(), a)
     {
-      this->insert(f, l);
+      table_.bulk_insert_unique(f, l, false);
     }
 
     template <class T, class H, class P, class A>
@@ -1188,6 +1193,14 @@ namespace boost {
       this->insert(list.begin(), list.end());
     }
 
+    template <class T, class H, class P, class A>
+    template <class InputIt>
+    void unordered_set<T, H, P, A>::bulk_insert(
+      InputIt first, InputIt last, bool assume_unique)
+    {
+      table_.bulk_insert_unique(first, last, assume_unique);
+    }
+
     template <class T, class H, class P, class A>
     typename unordered_set<T, H, P, A>::iterator
     unordered_set<T, H, P, A>::erase(const_iterator position)
@@ -1945,6 +1958,8 @@ namespace boost {
       boost::core::invoke_swap(x.inserted, y.inserted);
       boost::core::invoke_swap(x.position, y.position);
     }
+
+    BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_END
   } // namespace unordered
 
   namespace serialization {
@@ -13,11 +13,14 @@
 #endif
 
 #include <boost/container_hash/hash_fwd.hpp>
+#include <boost/unordered/detail/grouped_keys.hpp>
 #include <functional>
 #include <memory>
 
 namespace boost {
   namespace unordered {
+    BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_BEGIN
+
     template <class T, class H = boost::hash<T>, class P = std::equal_to<T>,
       class A = std::allocator<T> >
     class unordered_set;
@@ -56,6 +59,8 @@ namespace boost {
 
     template <class N, class T, class A> class node_handle_set;
     template <class Iter, class NodeType> struct insert_return_type_set;
+
+    BOOST_UNORDERED_GROUPED_KEYS_NAMESPACE_END
   } // namespace unordered
 
   using boost::unordered::unordered_multiset;
@@ -224,6 +224,59 @@ namespace {
     check_raii_counts();
   }
 
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+  template <typename X, class GF>
+  void parallel_merge_tests(X*, GF gen_factory, test::random_generator rg)
+  {
+    using flat_container_type = flat_container<X>;
+    static constexpr auto value_type_cardinality =
+      value_cardinality<typename X::value_type>::value;
+    using allocator_type = typename X::allocator_type;
+
+    auto gen = gen_factory.template get<X>();
+    auto values = make_random_values(1024 * 8, [&] { return gen(rg); });
+    auto reference_cont = reference_container<X>(values.begin(), values.end());
+
+    {
+      raii::reset_counts();
+
+      X x(0, hasher(1), key_equal(2), allocator_type(3));
+      std::vector<flat_container_type> sources;
+      std::size_t num_values = 0;
+      for (auto s : split<typename X::value_type>(values, num_threads)) {
+        sources.emplace_back(
+          s.begin(), s.end(), 0, hasher(1), key_equal(2), allocator_type(3));
+        num_values += sources.back().size();
+      }
+
+      auto const old_mc = +raii::move_constructor;
+      auto num_merged =
+        x.merge(std::execution::par, sources.begin(), sources.end());
+
+      BOOST_TEST_EQ(num_merged, reference_cont.size());
+      BOOST_TEST_EQ(
+        +raii::move_constructor,
+        old_mc + value_type_cardinality * reference_cont.size());
+
+      std::size_t num_left = 0;
+      for (auto const& y : sources) {
+        num_left += y.size();
+        for (auto const& v : y) {
+          BOOST_TEST(x.contains(get_key(v)));
+        }
+      }
+      BOOST_TEST_EQ(num_merged + num_left, num_values);
+
+      test_fuzzy_matches_reference(x, reference_cont, rg);
+
+      // sources already drained of unique keys merge nothing
+      BOOST_TEST_EQ(
+        x.merge(std::execution::par, sources.begin(), sources.end()), 0u);
+    }
+    check_raii_counts();
+  }
+#endif
+
 } // namespace
 
 // clang-format off
@@ -239,6 +292,14 @@ UNORDERED_TEST(
   ((test_maps)(test_sets))
   ((value_type_generator_factory))
   ((default_generator)(sequential)(limited_range)))
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+UNORDERED_TEST(
+  parallel_merge_tests,
+  ((test_map)(test_set))
+  ((value_type_generator_factory))
+  ((default_generator)(sequential)(limited_range)))
+#endif
 // clang-format on
 
 RUN_TESTS()
@@ -2,17 +2,33 @@
 // Distributed under the Boost Software License, Version 1.0. (See accompanying
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
+#define BOOST_UNORDERED_ENABLE_INCREMENTAL_CHECKPOINTS
+
 #include "../objects/test.hpp"
 #include "../helpers/random_values.hpp"
+#include "common_helpers.hpp"
 
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/xml_oarchive.hpp>
 #include <boost/archive/xml_iarchive.hpp>
 #include <boost/serialization/nvp.hpp>
+#include <boost/unordered/async_serialization.hpp>
 #include <boost/unordered/concurrent_flat_map.hpp>
 #include <boost/unordered/concurrent_flat_set.hpp>
 
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
 namespace {
 
   template <class Container, typename ArchivePair>
@@ -59,6 +75,630 @@ namespace {
     }
   }
 
+  template <class Container, typename ArchivePair>
+  void snapshot_tests(
+    Container*, ArchivePair*, test::random_generator generator)
+  {
+    using output_archive = typename ArchivePair::first_type;
+    using input_archive = typename ArchivePair::second_type;
+
+    std::size_t const chunk_sizes[] = {0, 1, 64};
+    for (std::size_t chunk_size : chunk_sizes) {
+      BOOST_LIGHTWEIGHT_TEST_OSTREAM << "snapshot_tests, chunk_size "
+                                     << chunk_size << "\n";
+
+      {
+        Container c;
+
+        std::ostringstream oss;
+        {
+          output_archive oa(oss);
+          c.save_snapshot(oa, chunk_size);
+        }
+
+        test::random_values<Container> values(100, generator);
+        Container c2(values.begin(), values.end());
+        std::istringstream iss(oss.str());
+        input_archive ia(iss);
+        c2.load_snapshot(ia);
+        BOOST_TEST(c2.empty());
+      }
+
+      {
+        test::random_values<Container> values(1000, generator);
+        Container c(values.begin(), values.end());
+
+        std::ostringstream oss;
+        {
+          output_archive oa(oss);
+          c.save_snapshot(oa, chunk_size);
+        }
+
+        Container c2;
+        std::istringstream iss(oss.str());
+        input_archive ia(iss);
+        c2.load_snapshot(ia);
+        BOOST_TEST(c == c2);
+      }
+    }
+  }
+
+  template <class Container, typename ArchivePair>
+  void layout_serialization_tests(
+    Container*, ArchivePair*, test::random_generator generator)
+  {
+    using output_archive = typename ArchivePair::first_type;
+    using input_archive = typename ArchivePair::second_type;
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "layout_serialization_tests1\n";
+    {
+      Container c;
+
+      std::ostringstream oss;
+      {
+        output_archive oa(oss);
+        c.save_layout(oa);
+      }
+
+      test::random_values<Container> values(100, generator);
+      Container c2(values.begin(), values.end());
+      std::istringstream iss(oss.str());
+      input_archive ia(iss);
+      c2.load_layout(ia);
+      BOOST_TEST(c2.empty());
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "layout_serialization_tests2\n";
+    {
+      test::random_values<Container> values(1000, generator);
+      Container c(values.begin(), values.end());
+
+      std::ostringstream oss;
+      {
+        output_archive oa(oss);
+        c.save_layout(oa);
+      }
+
+      Container c2;
+      std::istringstream iss(oss.str());
+      input_archive ia(iss);
+      c2.load_layout(ia);
+      BOOST_TEST(c == c2);
+      BOOST_TEST_EQ(c.bucket_count(), c2.bucket_count());
+
+      // different hash function: elements are inserted the regular way
+      Container c3(0, test::hash(1));
+      std::istringstream iss3(oss.str());
+      input_archive ia3(iss3);
+      c3.load_layout(ia3);
+      BOOST_TEST(c == c3);
+    }
+  }
+
+  template <class Container, typename ArchivePair>
+  std::string save_delta(Container const& c, ArchivePair*)
+  {
+    std::ostringstream oss;
+    {
+      typename ArchivePair::first_type oa(oss);
+      c.save_delta(oa);
+    }
+    return oss.str();
+  }
+
+  template <class Container, typename ArchivePair>
+  void apply_delta(Container& c, std::string const& delta, ArchivePair*)
+  {
+    std::istringstream iss(delta);
+    typename ArchivePair::second_type ia(iss);
+    c.apply_delta(ia);
+  }
+
+  template <class Container, typename ArchivePair>
+  void delta_tests(
+    Container*, ArchivePair* ap, test::random_generator generator)
+  {
+    using value_type = typename Container::value_type;
+
+    test::random_values<Container> values(1000, generator);
+    Container c(values.begin(), values.end());
+    Container c2;
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "delta_tests, initial delta\n";
+    std::string const full = save_delta(c, ap);
+    apply_delta(c2, full, ap);
+    BOOST_TEST(c == c2);
+    BOOST_TEST_EQ(c.bucket_count(), c2.bucket_count());
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "delta_tests, no changes\n";
+    {
+      std::string const delta = save_delta(c, ap);
+      BOOST_TEST_LT(delta.size(), full.size() / 10);
+      apply_delta(c2, delta, ap);
+      BOOST_TEST(c == c2);
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "delta_tests, few changes\n";
+    {
+      // erase_if would access every group
+      std::size_t n = 0;
+      for (auto const& v : values) {
+        if (n++ % 100 == 0) {
+          c.erase(get_key(v));
+        }
+      }
+      test::random_values<Container> more(10, generator);
+      c.insert(more.begin(), more.end());
+      c.visit_while([](value_type const&) { return false; });
+
+      std::string const delta = save_delta(c, ap);
+      BOOST_TEST_LT(delta.size(), full.size() / 2);
+      apply_delta(c2, delta, ap);
+      BOOST_TEST(c == c2);
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "delta_tests, rehash\n";
+    {
+      test::random_values<Container> more(5000, generator);
+      c.insert(more.begin(), more.end());
+      apply_delta(c2, save_delta(c, ap), ap);
+      BOOST_TEST(c == c2);
+      BOOST_TEST_EQ(c.bucket_count(), c2.bucket_count());
+
+      // c3 is out of sync
+      Container c3;
+      std::string const delta = save_delta(c, ap);
+      BOOST_TEST_THROWS(apply_delta(c3, delta, ap), std::runtime_error);
+      apply_delta(c2, delta, ap);
+      BOOST_TEST(c == c2);
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "delta_tests, clear\n";
+    {
+      c.clear();
+      apply_delta(c2, save_delta(c, ap), ap);
+      BOOST_TEST(c2.empty());
+
+      c.insert(values.begin(), values.end());
+      apply_delta(c2, save_delta(c, ap), ap);
+      BOOST_TEST(c == c2);
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "delta_tests, hash mismatch\n";
+    {
+      Container c3(0, test::hash(1));
+      c.clear();
+      c.insert(values.begin(), values.end());
+      BOOST_TEST_THROWS(
+        apply_delta(c3, save_delta(c, ap), ap), std::runtime_error);
+    }
+  }
+
+  struct fingerprinted_hash
+  {
+    std::uint64_t seed;
+
+    std::size_t operator()(int x) const
+    {
+      return boost::hash<int>()(x) ^ static_cast<std::size_t>(seed);
+    }
+
+    std::uint64_t fingerprint() const { return seed; }
+  };
+
+  template <typename ArchivePair>
+  void fingerprint_delta_tests(ArchivePair* ap)
+  {
+    using container = boost::concurrent_flat_map<int, int, fingerprinted_hash>;
+
+    container c(0, fingerprinted_hash{1}), c2(0, fingerprinted_hash{1}),
+      c3(0, fingerprinted_hash{2});
+    for (int i = 0; i < 1000; ++i) {
+      c.emplace(i, i);
+    }
+
+    std::string const full = save_delta(c, ap);
+    apply_delta(c2, full, ap);
+    BOOST_TEST(c == c2);
+
+    // positional deltas can't be applied with a different hash function
+    BOOST_TEST_THROWS(apply_delta(c3, full, ap), std::runtime_error);
+
+    c.erase(0);
+    c.emplace(1000, 1000);
+    apply_delta(c2, save_delta(c, ap), ap);
+    BOOST_TEST(c == c2);
+  }
+
+  template <class Container, typename ArchivePair>
+  void async_serialization_tests(
+    Container*, ArchivePair*, test::random_generator generator)
+  {
+    using output_archive = typename ArchivePair::first_type;
+    using input_archive = typename ArchivePair::second_type;
+
+    test::random_values<Container> values(1000, generator);
+    Container c(values.begin(), values.end());
+
+    std::stringstream ss;
+    boost::async_save<output_archive>(ss, c).get();
+    Container c2 = boost::async_save<output_archive>(ss, Container(c)).get();
+    BOOST_TEST(c == c2);
+
+    Container c3 = boost::async_load<input_archive, Container>(ss).get();
+    BOOST_TEST(c == c3);
+    Container c4 = boost::async_load<input_archive, Container>(ss).get();
+    BOOST_TEST(c == c4);
+  }
+
+  void concurrent_async_serialization_tests()
+  {
+    using container = boost::concurrent_flat_map<int, int>;
+
+    // the container is only held in a shared lock while being saved
+    container c;
+    for (int i = 0; i < 100000; ++i) {
+      c.emplace(i, i);
+    }
+
+    std::stringstream ss;
+    auto f = boost::async_save<boost::archive::text_oarchive>(ss, c);
+    for (int i = 0; i < 1000; ++i) {
+      c.visit(1000 + i, [](container::value_type& x) { ++x.second; });
+      c.erase(i);
+      c.emplace(100000 + i, i);
+    }
+    f.get();
+
+    auto c2 =
+      boost::async_load<boost::archive::text_iarchive, container>(ss).get();
+    BOOST_TEST_GE(c2.size(), 99000u);
+    for (int i = 1000; i < 100000; ++i) {
+      BOOST_TEST_EQ(c2.count(i), 1u);
+    }
+  }
+
+  template <class T> T compact_value(std::mt19937_64& rng, std::size_t i)
+  {
+    // mix of small, extreme and random values
+    switch (i % 4) {
+    case 0:
+      return static_cast<T>(i / 4);
+    case 1:
+      return i % 8 == 1 ? (std::numeric_limits<T>::max)()
+                        : std::numeric_limits<T>::lowest();
+    default:
+      return static_cast<T>(
+        static_cast<T>(rng()) / static_cast<T>(i % 3 + 1));
+    }
+  }
+
+  template <class Key, class T>
+  void fill_compact(
+    boost::concurrent_flat_map<Key, T>& c, std::size_t n, std::mt19937_64& rng)
+  {
+    for (std::size_t i = 0; i < n; ++i) {
+      c.insert_or_assign(
+        compact_value<Key>(rng, i), compact_value<T>(rng, i + 1));
+    }
+  }
+
+  template <class Key>
+  void fill_compact(
+    boost::concurrent_flat_set<Key>& c, std::size_t n, std::mt19937_64& rng)
+  {
+    for (std::size_t i = 0; i < n; ++i) {
+      c.insert(compact_value<Key>(rng, i));
+    }
+  }
+
+  template <class Container, typename ArchivePair>
+  void compact_serialization_tests(Container*, ArchivePair*)
+  {
+    using output_archive = typename ArchivePair::first_type;
+    using input_archive = typename ArchivePair::second_type;
+
+    std::mt19937_64 rng(4213);
+    std::size_t const sizes[] = {0, 1, 1000, 100000};
+    for (std::size_t n : sizes) {
+      BOOST_LIGHTWEIGHT_TEST_OSTREAM << "compact_serialization_tests, size "
+                                     << n << "\n";
+
+      Container c;
+      fill_compact(c, n, rng);
+
+      std::ostringstream oss;
+      {
+        output_archive oa(oss);
+        c.save_compact(oa);
+        oa << boost::serialization::make_nvp("size", n);
+      }
+
+      Container c2;
+      fill_compact(c2, 100, rng);
+      std::istringstream iss(oss.str());
+      input_archive ia(iss);
+      c2.load_compact(ia);
+      std::size_t n2 = 0;
+      ia >> boost::serialization::make_nvp("size", n2);
+      BOOST_TEST(c == c2);
+      BOOST_TEST_EQ(n, n2);
+    }
+  }
+
+  void compact_serialization_size_tests()
+  {
+    boost::concurrent_flat_map<std::uint64_t, std::uint32_t> c;
+    for (std::uint32_t i = 0; i < 100000; ++i) {
+      c.emplace(1000000000000ull + 3 * i, i % 1000);
+    }
+
+    std::ostringstream oss, oss2;
+    {
+      boost::archive::binary_oarchive oa(oss);
+      oa << boost::serialization::make_nvp("container", c);
+      boost::archive::binary_oarchive oa2(oss2);
+      c.save_compact(oa2);
+    }
+    BOOST_TEST_LT(oss2.str().size() * 3, oss.str().size());
+
+    // type mismatch
+    boost::concurrent_flat_map<std::uint64_t, std::int32_t> c2;
+    std::istringstream iss(oss2.str());
+    boost::archive::binary_iarchive ia(iss);
+    BOOST_TEST_THROWS(c2.load_compact(ia), std::runtime_error);
+  }
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+  template <class Container, typename ArchivePair>
+  void parallel_snapshot_tests(
+    Container*, ArchivePair*, test::random_generator generator)
+  {
+    using output_archive = typename ArchivePair::first_type;
+    using input_archive = typename ArchivePair::second_type;
+
+    // more than one batch
+    std::size_t const sizes[] = {0, 100, 40000};
+    for (std::size_t n : sizes) {
+      BOOST_LIGHTWEIGHT_TEST_OSTREAM << "parallel_snapshot_tests, size " << n
+                                     << "\n";
+
+      test::random_values<Container> values(n, generator);
+      Container c(values.begin(), values.end());
+
+      std::ostringstream oss;
+      {
+        output_archive oa(oss);
+        c.save_snapshot(oa);
+      }
+
+      test::random_values<Container> values2(100, generator);
+      Container c2(values2.begin(), values2.end());
+      std::istringstream iss(oss.str());
+      input_archive ia(iss);
+      c2.load_snapshot(std::execution::par, ia);
+      BOOST_TEST(c == c2);
+    }
+  }
+
+  void duplicate_snapshot_tests()
+  {
+    using map_type = boost::concurrent_flat_map<int, int>;
+    using set_type = boost::concurrent_flat_set<int>;
+    using version_type = boost::unordered::detail::serialization_version<int>;
+
+    // snapshot as written by save_snapshot, with keys [0, n) saved three
+    // times, with mapped values 0, 1 and 2, all within the same batch
+    int const n = 5000;
+    std::ostringstream oss;
+    {
+      boost::archive::text_oarchive oa(oss);
+      version_type const version;
+      std::size_t const size_hint = n;
+      std::size_t const count = 3 * n;
+      std::size_t const end = 0;
+
+      oa << boost::serialization::make_nvp("key_version", version);
+      oa << boost::serialization::make_nvp("mapped_version", version);
+      oa << boost::serialization::make_nvp("size_hint", size_hint);
+      oa << boost::serialization::make_nvp("count", count);
+      for (int r = 0; r < 3; ++r) {
+        for (int i = 0; i < n; ++i) {
+          oa << boost::serialization::make_nvp("key", i);
+          oa << boost::serialization::make_nvp("mapped", r);
+        }
+      }
+      oa << boost::serialization::make_nvp("count", end);
+    }
+
+    map_type c1, c2;
+    {
+      std::istringstream iss(oss.str());
+      boost::archive::text_iarchive ia(iss);
+      c1.load_snapshot(ia);
+    }
+    {
+      std::istringstream iss(oss.str());
+      boost::archive::text_iarchive ia(iss);
+      c2.load_snapshot(std::execution::par, ia);
+    }
+    BOOST_TEST_EQ(c1.size(), static_cast<std::size_t>(n));
+    BOOST_TEST(c1 == c2);
+    c2.visit_all([](map_type::value_type const& x) {
+      BOOST_TEST_EQ(x.second, 2);
+    });
+
+    std::ostringstream oss2;
+    {
+      boost::archive::text_oarchive oa(oss2);
+      version_type const version;
+      std::size_t const size_hint = n;
+      std::size_t const count = 3 * n;
+      std::size_t const end = 0;
+
+      oa << boost::serialization::make_nvp("value_version", version);
+      oa << boost::serialization::make_nvp("size_hint", size_hint);
+      oa << boost::serialization::make_nvp("count", count);
+      for (int r = 0; r < 3; ++r) {
+        for (int i = 0; i < n; ++i) {
+          oa << boost::serialization::make_nvp("item", i);
+        }
+      }
+      oa << boost::serialization::make_nvp("count", end);
+    }
+
+    set_type s1, s2;
+    {
+      std::istringstream iss(oss2.str());
+      boost::archive::text_iarchive ia(iss);
+      s1.load_snapshot(ia);
+    }
+    {
+      std::istringstream iss(oss2.str());
+      boost::archive::text_iarchive ia(iss);
+      s2.load_snapshot(std::execution::par, ia);
+    }
+    BOOST_TEST_EQ(s1.size(), static_cast<std::size_t>(n));
+    BOOST_TEST(s1 == s2);
+  }
+#endif
+
+  template <class Container>
+  void concurrent_snapshot_tests(Container*, std::size_t chunk_size)
+  {
+    // [0, 1000) stays put, [1000, 2000) is repeatedly inserted and erased,
+    // [2000, 20000) is inserted during the save, forcing rehashes
+    Container c;
+    for (int i = 0; i < 2000; ++i) {
+      c.emplace(i, i);
+    }
+
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    threads.emplace_back([&] {
+      while (!done) {
+        for (int i = 1000; i < 2000; ++i) {
+          c.erase(i);
+        }
+        for (int i = 1000; i < 2000; ++i) {
+          c.emplace(i, i);
+        }
+      }
+    });
+    threads.emplace_back([&] {
+      for (int i = 2000; i < 20000; ++i) {
+        c.emplace(i, i);
+      }
+    });
+
+    std::ostringstream oss;
+    {
+      boost::archive::text_oarchive oa(oss);
+      for (int n = 0; n < 10; ++n) {
+        c.save_snapshot(oa, chunk_size);
+      }
+    }
+    done = true;
+    for (auto& th : threads) {
+      th.join();
+    }
+
+    std::istringstream iss(oss.str());
+    boost::archive::text_iarchive ia(iss);
+    for (int n = 0; n < 10; ++n) {
+      Container c2;
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+      if (n % 2) {
+        c2.load_snapshot(std::execution::par, ia);
+      } else {
+        c2.load_snapshot(ia);
+      }
+#else
+      c2.load_snapshot(ia);
+#endif
+      BOOST_TEST_GE(c2.size(), 1000u);
+      BOOST_TEST_LE(c2.size(), 20000u);
+      for (int i = 0; i < 1000; ++i) {
+        BOOST_TEST_EQ(c2.count(i), 1u);
+      }
+      c2.visit_all([](typename Container::value_type const& x) {
+        BOOST_TEST_EQ(x.first, x.second);
+        BOOST_TEST_GE(x.first, 0);
+        BOOST_TEST_LT(x.first, 20000);
+      });
+    }
+  }
+
+  void concurrent_delta_tests()
+  {
+    using container = boost::concurrent_flat_map<int, int>;
+    using archive_pair =
+      std::pair<boost::archive::text_oarchive, boost::archive::text_iarchive>;
+
+    // [0, 1000) stays put, [1000, 2000) is repeatedly inserted and erased,
+    // [2000, 20000) is inserted during the checkpoints, forcing rehashes
+    container c;
+    for (int i = 0; i < 2000; ++i) {
+      c.emplace(i, i);
+    }
+
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    threads.emplace_back([&] {
+      while (!done) {
+        for (int i = 1000; i < 2000; ++i) {
+          c.erase(i);
+        }
+        for (int i = 1000; i < 2000; ++i) {
+          c.emplace(i, i);
+        }
+      }
+    });
+    threads.emplace_back([&] {
+      for (int i = 2000; i < 20000; ++i) {
+        c.emplace(i, i);
+      }
+    });
+
+    std::vector<std::string> deltas;
+    for (int n = 0; n < 20; ++n) {
+      deltas.push_back(save_delta(c, (archive_pair*)nullptr));
+    }
+    done = true;
+    for (auto& th : threads) {
+      th.join();
+    }
+    deltas.push_back(save_delta(c, (archive_pair*)nullptr));
+
+    container c2;
+    for (auto const& delta : deltas) {
+      apply_delta(c2, delta, (archive_pair*)nullptr);
+      for (int i = 0; i < 1000; ++i) {
+        BOOST_TEST_EQ(c2.count(i), 1u);
+      }
+      c2.visit_all([](container::value_type const& x) {
+        BOOST_TEST_EQ(x.first, x.second);
+        BOOST_TEST_GE(x.first, 0);
+        BOOST_TEST_LT(x.first, 20000);
+      });
+    }
+
+    // last delta was saved with no concurrent modifications
+    BOOST_TEST(c == c2);
+    BOOST_TEST_EQ(c.size(), c2.size());
+  }
+
+  void concurrent_snapshot_tests()
+  {
+    std::size_t const chunk_sizes[] = {0, 1, 64};
+    for (std::size_t chunk_size : chunk_sizes) {
+      BOOST_LIGHTWEIGHT_TEST_OSTREAM
+        << "concurrent_snapshot_tests, chunk_size " << chunk_size << "\n";
+      concurrent_snapshot_tests(
+        (boost::concurrent_flat_map<int, int>*)nullptr, chunk_size);
+    }
+  }
+
   using test::default_generator;
 
   std::pair<
@@ -77,6 +717,71 @@ namespace {
     ((test_flat_map)(test_flat_set))
     ((text_archive)(xml_archive))
     ((default_generator)))
+
+  UNORDERED_TEST(snapshot_tests,
+    ((test_flat_map)(test_flat_set))
+    ((text_archive)(xml_archive))
+    ((default_generator)))
+
+  std::pair<
+    boost::archive::binary_oarchive, boost::archive::binary_iarchive>*
+    binary_archive;
+
+  boost::concurrent_flat_map<std::uint64_t, std::uint32_t>* test_u64_u32_map;
+  boost::concurrent_flat_map<std::int16_t, double>* test_i16_double_map;
+  boost::concurrent_flat_map<float, std::int64_t>* test_float_i64_map;
+  boost::concurrent_flat_set<std::int32_t>* test_i32_set;
+  boost::concurrent_flat_set<double>* test_double_set;
+
+  UNORDERED_TEST(compact_serialization_tests,
+    ((test_u64_u32_map)(test_i16_double_map)(test_float_i64_map)
+     (test_i32_set)(test_double_set))
+    ((text_archive)(xml_archive)(binary_archive)))
+
+  UNORDERED_AUTO_TEST (compact_serialization_size) {
+    compact_serialization_size_tests();
+  }
+
+  UNORDERED_TEST(layout_serialization_tests,
+    ((test_flat_map)(test_flat_set))
+    ((text_archive)(xml_archive))
+    ((default_generator)))
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+  UNORDERED_TEST(parallel_snapshot_tests,
+    ((test_flat_map)(test_flat_set))
+    ((text_archive)(xml_archive))
+    ((default_generator)))
+
+  UNORDERED_AUTO_TEST (duplicate_snapshot) {
+    duplicate_snapshot_tests();
+  }
+#endif
+
+  UNORDERED_AUTO_TEST (concurrent_snapshot) {
+    concurrent_snapshot_tests();
+  }
+
+  UNORDERED_TEST(delta_tests,
+    ((test_flat_map)(test_flat_set))
+    ((text_archive)(xml_archive))
+    ((default_generator)))
+
+  UNORDERED_TEST(fingerprint_delta_tests,
+    ((text_archive)(xml_archive)))
+
+  UNORDERED_AUTO_TEST (concurrent_delta) {
+    concurrent_delta_tests();
+  }
+
+  UNORDERED_TEST(async_serialization_tests,
+    ((test_flat_map)(test_flat_set))
+    ((text_archive)(xml_archive))
+    ((default_generator)))
+
+  UNORDERED_AUTO_TEST (concurrent_async_serialization) {
+    concurrent_async_serialization_tests();
+  }
 }
 
 RUN_TESTS()
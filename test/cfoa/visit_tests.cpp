@@ -964,12 +964,30 @@ namespace {
       raii::destructor);
   }
 
+  struct batch_hash
+  {
+    std::size_t operator()(raii const& x) const noexcept
+    {
+      return boost::hash<raii>()(x);
+    }
+
+    template <class FwdIterator>
+    void hash_batch(FwdIterator first, std::size_t n, std::size_t* out) const
+    {
+      for (std::size_t i = 0; i < n; ++i, ++first) {
+        out[i] = (*this)(*first);
+      }
+    }
+  };
+
   boost::unordered::concurrent_flat_map<raii, raii>* map;
   boost::unordered::concurrent_flat_map<raii, raii, transp_hash,
     transp_key_equal>* transp_map;
+  boost::unordered::concurrent_flat_map<raii, raii, batch_hash>* batch_map;
   boost::unordered::concurrent_flat_set<raii>* set;
   boost::unordered::concurrent_flat_set<raii, transp_hash,
     transp_key_equal>* transp_set;
+  boost::unordered::concurrent_flat_set<raii, batch_hash>* batch_set;
 
 } // namespace
 
@@ -1010,7 +1028,7 @@ UNORDERED_TEST(
 
 UNORDERED_TEST(
   bulk_visit,
-  ((map)(set))
+  ((map)(set)(batch_map)(batch_set))
   ((regular_key_extract))
   ((value_type_generator_factory))
   ((sequential))
@@ -41,8 +41,45 @@ typedef boost::unordered_node_set<
   test::exception::allocator<test::exception::object> >
   test_pair_node_set;
 
-#define CONTAINER_SEQ (test_set)(test_map)(test_node_set)(test_node_map)
-#define CONTAINER_PAIR_SEQ (test_pair_set)(test_map)(test_pair_node_set)(test_node_map)
+typedef boost::unordered_flat_multiset<test::exception::object,
+  test::exception::hash, test::exception::equal_to,
+  test::exception::allocator2<test::exception::object> >
+  test_multiset;
+
+typedef boost::unordered_flat_multimap<test::exception::object,
+  test::exception::object, test::exception::hash, test::exception::equal_to,
+  test::exception::allocator<test::exception::object> >
+  test_multimap;
+
+typedef boost::unordered_flat_multiset<
+  std::pair<test::exception::object, test::exception::object>,
+  test::exception::hash, test::exception::equal_to,
+  test::exception::allocator2<test::exception::object> >
+  test_pair_multiset;
+
+typedef boost::unordered_node_multiset<test::exception::object,
+  test::exception::hash, test::exception::equal_to,
+  test::exception::allocator2<test::exception::object> >
+  test_node_multiset;
+
+typedef boost::unordered_node_multimap<test::exception::object,
+  test::exception::object, test::exception::hash, test::exception::equal_to,
+  test::exception::allocator<test::exception::object> >
+  test_node_multimap;
+
+typedef boost::unordered_node_multiset<
+  std::pair<test::exception::object, test::exception::object>,
+  test::exception::hash, test::exception::equal_to,
+  test::exception::allocator2<test::exception::object> >
+  test_pair_node_multiset;
+
+#define CONTAINER_SEQ                                                          \
+  (test_set)(test_multiset)(test_map)(test_multimap)                           \
+  (test_node_set)(test_node_multiset)(test_node_map)(test_node_multimap)
+#define CONTAINER_PAIR_SEQ                                                     \
+  (test_pair_set)(test_pair_multiset)(test_map)(test_multimap)                 \
+  (test_pair_node_set)(test_pair_node_multiset)(test_node_map)                 \
+  (test_node_multimap)
 #else
 typedef boost::unordered_set<test::exception::object, test::exception::hash,
   test::exception::equal_to,
@@ -231,13 +231,18 @@ using test::generate_collisions;
 
 #ifdef BOOST_UNORDERED_FOA_TESTS
 test_set* test_set_;
+test_multiset* test_multiset_;
 test_map* test_map_;
+test_multimap* test_multimap_;
 test_node_set* test_node_set_;
+test_node_multiset* test_node_multiset_;
 test_node_map* test_node_map_;
+test_node_multimap* test_node_multimap_;
 
 // clang-format off
 UNORDERED_TEST(insert_exception_test,
-    ((test_set_)(test_map_)(test_node_set_)(test_node_map_))
+    ((test_set_)(test_multiset_)(test_map_)(test_multimap_)
+     (test_node_set_)(test_node_multiset_)(test_node_map_)(test_node_multimap_))
     ((insert_lvalue)(insert_lvalue_begin)(insert_lvalue_end)
      (insert_lvalue_pos)(insert_single_item_range)
      (emplace_lvalue)(emplace_lvalue_begin)(emplace_lvalue_end)
@@ -247,7 +252,8 @@ UNORDERED_TEST(insert_exception_test,
 )
 
 UNORDERED_TEST(insert_rehash_exception_test,
-    ((test_set_)(test_map_)(test_node_set_)(test_node_map_))
+    ((test_set_)(test_multiset_)(test_map_)(test_multimap_)
+     (test_node_set_)(test_node_multiset_)(test_node_map_)(test_node_multimap_))
     ((insert_lvalue)(insert_lvalue_begin)(insert_lvalue_end)
      (insert_lvalue_pos)(insert_single_item_range)
      (emplace_lvalue)(emplace_lvalue_begin)(emplace_lvalue_end)
@@ -319,16 +325,22 @@ struct pair_emplace2_type : inserter_base
 
 #ifdef BOOST_UNORDERED_FOA_TESTS
 test_pair_set* test_pair_set_;
+test_pair_multiset* test_pair_multiset_;
 test_pair_node_set* test_pair_node_set_;
+test_pair_node_multiset* test_pair_node_multiset_;
 
 // clang-format off
 UNORDERED_TEST(insert_exception_test,
-    ((test_pair_set_)(test_map_)(test_pair_node_set_)(test_node_map_))
+    ((test_pair_set_)(test_pair_multiset_)(test_map_)(test_multimap_)
+     (test_pair_node_set_)(test_pair_node_multiset_)(test_node_map_)
+     (test_node_multimap_))
     ((pair_emplace)(pair_emplace2))
     ((default_generator)(limited_range)(generate_collisions))
 )
 UNORDERED_TEST(insert_rehash_exception_test,
-    ((test_pair_set_)(test_map_)(test_pair_node_set_)(test_node_map_))
+    ((test_pair_set_)(test_pair_multiset_)(test_map_)(test_multimap_)
+     (test_pair_node_set_)(test_pair_node_multiset_)(test_node_map_)
+     (test_node_multimap_))
     ((pair_emplace)(pair_emplace2))
     ((default_generator)(limited_range)(generate_collisions))
 )
@@ -480,12 +492,14 @@ void insert_range_rehash_exception_test(T*, test::random_generator gen)
 #ifdef BOOST_UNORDERED_FOA_TESTS
 // clang-format off
 UNORDERED_TEST(insert_range_exception_test,
-    ((test_set_)(test_map_)(test_node_set_)(test_node_map_))
+    ((test_set_)(test_multiset_)(test_map_)(test_multimap_)
+     (test_node_set_)(test_node_multiset_)(test_node_map_)(test_node_multimap_))
     ((default_generator)(limited_range)(generate_collisions))
 )
 
 UNORDERED_TEST(insert_range_rehash_exception_test,
-    ((test_set_)(test_map_)(test_node_set_)(test_node_map_))
+    ((test_set_)(test_multiset_)(test_map_)(test_multimap_)
+     (test_node_set_)(test_node_multiset_)(test_node_map_)(test_node_multimap_))
     ((default_generator)(limited_range)(generate_collisions))
 )
 // clang-format on
@@ -501,6 +515,60 @@ UNORDERED_TEST(insert_range_rehash_exception_test,
     ((default_generator)(limited_range)(generate_collisions))
 )
 // clang-format on
+
+template <typename T, typename Values>
+void bulk_insert_exception_test_impl(T x, Values const& v)
+{
+  test::ordered<T> tracker;
+  tracker.insert(x.begin(), x.end());
+
+  try {
+    ENABLE_EXCEPTIONS;
+    x.bulk_insert(v.begin(), v.end());
+  } catch (...) {
+    test::check_equivalent_keys(x);
+    throw;
+  }
+
+  test::check_equivalent_keys(x);
+  tracker.insert(v.begin(), v.end());
+  tracker.compare(x);
+}
+
+template <typename T>
+void bulk_insert_exception_test(T*, test::random_generator gen)
+{
+  for (int i = 0; i < 5; ++i) {
+    test::random_values<T> v(10, gen);
+    T x;
+
+    EXCEPTION_LOOP(bulk_insert_exception_test_impl(x, v))
+  }
+}
+
+template <typename T>
+void bulk_insert_rehash_exception_test(T*, test::random_generator gen)
+{
+  for (int i = 0; i < 5; ++i) {
+    T x(1);
+    rehash_prep(x);
+
+    test::random_values<T> v2(5, gen);
+    EXCEPTION_LOOP(bulk_insert_exception_test_impl(x, v2))
+  }
+}
+
+// clang-format off
+UNORDERED_TEST(bulk_insert_exception_test,
+    ((test_set_)(test_map_))
+    ((default_generator)(limited_range)(generate_collisions))
+)
+
+UNORDERED_TEST(bulk_insert_rehash_exception_test,
+    ((test_set_)(test_map_))
+    ((default_generator)(limited_range)(generate_collisions))
+)
+// clang-format on
 #endif
 
 RUN_TESTS()
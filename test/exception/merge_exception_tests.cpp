@@ -70,6 +70,18 @@ boost::unordered_node_set<test::exception::object, test::exception::hash,
 boost::unordered_node_map<test::exception::object, test::exception::object,
   test::exception::hash, test::exception::equal_to,
   test::exception::allocator2<test::exception::object> >* test_node_map_;
+boost::unordered_flat_multiset<test::exception::object, test::exception::hash,
+  test::exception::equal_to,
+  test::exception::allocator<test::exception::object> >* test_multiset_;
+boost::unordered_flat_multimap<test::exception::object,
+  test::exception::object, test::exception::hash, test::exception::equal_to,
+  test::exception::allocator2<test::exception::object> >* test_multimap_;
+boost::unordered_node_multiset<test::exception::object, test::exception::hash,
+  test::exception::equal_to,
+  test::exception::allocator<test::exception::object> >* test_node_multiset_;
+boost::unordered_node_multimap<test::exception::object,
+  test::exception::object, test::exception::hash, test::exception::equal_to,
+  test::exception::allocator2<test::exception::object> >* test_node_multimap_;
 
 // clang-format off
 UNORDERED_MULTI_TEST(set_merge, merge_exception_test,
@@ -138,6 +150,47 @@ UNORDERED_MULTI_TEST(node_map_merge_collisions, merge_exception_test,
     ((generate_collisions))
     ((generate_collisions))
 )
+// Equal tags merge without rehashing when the layouts are compatible.
+UNORDERED_MULTI_TEST(multiset_merge, merge_exception_test,
+    ((test_multiset_))
+    ((test_multiset_))
+    ((0x0000)(0x6400)(0x0064)(0x0a64)(0x3232))
+    ((0x0000)(0x0001)(0x0102))
+    ((default_generator)(limited_range))
+    ((default_generator)(limited_range))
+)
+UNORDERED_MULTI_TEST(multimap_merge, merge_exception_test,
+    ((test_multimap_))
+    ((test_multimap_))
+    ((0x0000)(0x6400)(0x0064)(0x0a64)(0x3232))
+    ((0x0101)(0x0200)(0x0201))
+    ((default_generator)(limited_range))
+    ((default_generator)(limited_range))
+)
+UNORDERED_MULTI_TEST(multiset_merge_collisions, merge_exception_test,
+    ((test_multiset_))
+    ((test_multiset_))
+    ((0x0a0a))
+    ((0x0202)(0x0100)(0x0201))
+    ((generate_collisions))
+    ((generate_collisions))
+)
+UNORDERED_MULTI_TEST(node_multiset_merge, merge_exception_test,
+    ((test_node_multiset_))
+    ((test_node_multiset_))
+    ((0x0000)(0x6400)(0x0064)(0x0a64)(0x3232))
+    ((0x0000)(0x0001)(0x0102))
+    ((default_generator)(limited_range))
+    ((default_generator)(limited_range))
+)
+UNORDERED_MULTI_TEST(node_multimap_merge, merge_exception_test,
+    ((test_node_multimap_))
+    ((test_node_multimap_))
+    ((0x0000)(0x6400)(0x0064)(0x0a64)(0x3232))
+    ((0x0101)(0x0200)(0x0201))
+    ((default_generator)(limited_range))
+    ((default_generator)(limited_range))
+)
 // clang-format on
 #else
 boost::unordered_set<test::exception::object, test::exception::hash,
@@ -251,10 +251,22 @@ using unordered_node_set = boost::unordered_node_set<int, boost::hash<int>,
   std::equal_to<int>, test::allocator1<int> >;
 using unordered_node_map = boost::unordered_node_map<int, int, boost::hash<int>,
   std::equal_to<int>, test::allocator1<std::pair<int const, int> > >;
+using unordered_flat_multiset = boost::unordered_flat_multiset<int,
+  boost::hash<int>, std::equal_to<int>, test::allocator1<int> >;
+using unordered_flat_multimap = boost::unordered_flat_multimap<int, int,
+  boost::hash<int>, std::equal_to<int>,
+  test::allocator1<std::pair<int const, int> > >;
+using unordered_node_multiset = boost::unordered_node_multiset<int,
+  boost::hash<int>, std::equal_to<int>, test::allocator1<int> >;
+using unordered_node_multimap = boost::unordered_node_multimap<int, int,
+  boost::hash<int>, std::equal_to<int>,
+  test::allocator1<std::pair<int const, int> > >;
 
 #define SWAP_CONTAINER_SEQ \
  (unordered_flat_set)(unordered_flat_map) \
- (unordered_node_set)(unordered_node_map)
+ (unordered_node_set)(unordered_node_map) \
+ (unordered_flat_multiset)(unordered_flat_multimap) \
+ (unordered_node_multiset)(unordered_node_multimap)
 
 #else
 
@@ -613,6 +613,62 @@ namespace copy_tests {
      (test_map_no_select_copy)(test_multimap_no_select_copy))(
       (default_generator)(generate_collisions)(limited_range)))
   // clang-format on
+
+  // Equivalent elements are copied in runs of equal keys, so hash values need
+  // only be calculated once per run unless hashing is cheap and key
+  // comparison is not.
+
+  static std::size_t hash_calls = 0;
+
+  struct counting_hash
+  {
+    std::size_t operator()(int x) const
+    {
+      ++hash_calls;
+      return boost::hash<int>()(x);
+    }
+  };
+
+  struct cheap_counting_hash : counting_hash
+  {
+    typedef void is_cheap;
+  };
+
+  struct int_equal_to
+  {
+    bool operator()(int x, int y) const { return x == y; }
+  };
+
+  template <class Hash, class Pred>
+  static std::size_t copy_multimap_hash_calls()
+  {
+    typedef boost::unordered_multimap<int, int, Hash, Pred> multimap;
+
+    multimap x;
+    for (int i = 0; i < 100; ++i) {
+      for (int j = 0; j < 5; ++j) {
+        x.emplace(i, j);
+      }
+    }
+
+    hash_calls = 0;
+    multimap y(x);
+    std::size_t calls = hash_calls;
+
+    test::check_equivalent_keys(y);
+    BOOST_TEST(x == y);
+    return calls;
+  }
+
+  UNORDERED_AUTO_TEST (copy_equivalent_hash_calls) {
+    BOOST_TEST_EQ(
+      (copy_multimap_hash_calls<cheap_counting_hash, int_equal_to>()), 500u);
+    BOOST_TEST_EQ(
+      (copy_multimap_hash_calls<counting_hash, int_equal_to>()), 100u);
+    BOOST_TEST_EQ(
+      (copy_multimap_hash_calls<cheap_counting_hash, std::equal_to<int> >()),
+      100u);
+  }
 #endif
 } // namespace copy_tests
 
@@ -49,6 +49,20 @@ UNORDERED_AUTO_TEST (set_tests) {
   test_equal_insertion<node_set>(values[2], values[2] + 2);
   test_equal_insertion<node_set>(values[3], values[3] + 2);
   test_equal_insertion<node_set>(values[4], values[4] + 3);
+
+  typedef boost::unordered_flat_multiset<int> multiset;
+  test_equal_insertion<multiset>(values[0], values[0] + 1);
+  test_equal_insertion<multiset>(values[1], values[1] + 2);
+  test_equal_insertion<multiset>(values[2], values[2] + 2);
+  test_equal_insertion<multiset>(values[3], values[3] + 2);
+  test_equal_insertion<multiset>(values[4], values[4] + 3);
+
+  typedef boost::unordered_node_multiset<int> node_multiset;
+  test_equal_insertion<node_multiset>(values[0], values[0] + 1);
+  test_equal_insertion<node_multiset>(values[1], values[1] + 2);
+  test_equal_insertion<node_multiset>(values[2], values[2] + 2);
+  test_equal_insertion<node_multiset>(values[3], values[3] + 2);
+  test_equal_insertion<node_multiset>(values[4], values[4] + 3);
 #else
   typedef boost::unordered_set<int> set;
 
@@ -87,6 +101,14 @@ UNORDERED_AUTO_TEST (map_tests) {
   for (int i2 = 0; i2 < 5; ++i2)
     test_equal_insertion<boost::unordered_node_map<int, int> >(
       v[i2].begin(), v[i2].end());
+
+  for (int i3 = 0; i3 < 5; ++i3)
+    test_equal_insertion<boost::unordered_flat_multimap<int, int> >(
+      v[i3].begin(), v[i3].end());
+
+  for (int i4 = 0; i4 < 5; ++i4)
+    test_equal_insertion<boost::unordered_node_multimap<int, int> >(
+      v[i4].begin(), v[i4].end());
 #else
   for (int i = 0; i < 5; ++i)
     test_equal_insertion<boost::unordered_map<int, int> >(
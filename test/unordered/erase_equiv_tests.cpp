@@ -6,11 +6,7 @@
 // The code for erasing elements from containers with equivalent keys is very
 // hairy with several tricky edge cases - so explicitly test each one.
 
-// clang-format off
-#include "../helpers/prefix.hpp"
-#include <boost/unordered_map.hpp>
-#include "../helpers/postfix.hpp"
-// clang-format on
+#include "../helpers/unordered.hpp"
 
 #include "../helpers/test.hpp"
 #include "../helpers/list.hpp"
@@ -62,6 +58,17 @@ struct collision3_hash
   std::size_t operator()(int x) const { return static_cast<std::size_t>(x); }
 };
 
+#ifdef BOOST_UNORDERED_FOA_TESTS
+typedef boost::unordered_flat_multimap<int, int, collision_hash,
+  std::equal_to<int>, test::allocator1<std::pair<int const, int> > >
+  collide_map;
+typedef boost::unordered_node_multimap<int, int, collision2_hash,
+  std::equal_to<int>, test::allocator2<std::pair<int const, int> > >
+  collide_map2;
+typedef boost::unordered_flat_multimap<int, int, collision3_hash,
+  std::equal_to<int>, test::allocator2<std::pair<int const, int> > >
+  collide_map3;
+#else
 typedef boost::unordered_multimap<int, int, collision_hash, std::equal_to<int>,
   test::allocator1<std::pair<int const, int> > >
   collide_map;
@@ -71,6 +78,7 @@ typedef boost::unordered_multimap<int, int, collision2_hash, std::equal_to<int>,
 typedef boost::unordered_multimap<int, int, collision3_hash, std::equal_to<int>,
   test::allocator2<std::pair<int const, int> > >
   collide_map3;
+#endif
 typedef collide_map::value_type collide_value;
 typedef test::list<collide_value> collide_list;
 
@@ -0,0 +1,49 @@
+// Copyright 2026 agent
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/unordered/hash_traits.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/lightweight_test_trait.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+struct X1
+{
+    std::size_t operator()( int x ) const { return static_cast<std::size_t>( x ); }
+};
+
+struct X2
+{
+    std::size_t operator()( int x ) const { return static_cast<std::size_t>( x ) + 1; }
+
+    template<class FwdIterator>
+    void hash_batch( FwdIterator first, std::size_t n, std::size_t* out ) const
+    {
+        for( ; n--; ++first ) *out++ = ( *this )( *first );
+    }
+};
+
+int main()
+{
+    using boost::unordered::detail::has_hash_batch;
+
+    BOOST_TEST_TRAIT_FALSE((has_hash_batch<X1, int const*>));
+    BOOST_TEST_TRAIT_TRUE((has_hash_batch<X2, int const*>));
+    BOOST_TEST_TRAIT_TRUE((has_hash_batch<X2, std::vector<int>::iterator>));
+    BOOST_TEST_TRAIT_FALSE((has_hash_batch<boost::hash<int>, int const*>));
+    BOOST_TEST_TRAIT_FALSE((has_hash_batch<boost::hash<std::string>, std::string const*>));
+
+    int const v[] = { 1, 2, 3 };
+    std::size_t out[ 3 ];
+
+    boost::unordered::hash_batch<X2>::apply( X2(), v, 3, out );
+
+    BOOST_TEST_EQ( out[ 0 ], 2u );
+    BOOST_TEST_EQ( out[ 1 ], 3u );
+    BOOST_TEST_EQ( out[ 2 ], 4u );
+
+    return boost::report_errors();
+}
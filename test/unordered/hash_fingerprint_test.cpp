@@ -0,0 +1,61 @@
+// Copyright 2026 agent
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// an imitation of a third-party header specializing hash_fingerprint
+
+#include <boost/cstdint.hpp>
+
+struct X3
+{
+    boost::uint64_t seed;
+};
+
+namespace boost
+{
+namespace unordered
+{
+
+    template<class Hash> struct hash_fingerprint;
+    template<> struct hash_fingerprint< ::X3 >
+    {
+        static boost::uint64_t get( const ::X3& h ) { return h.seed; }
+    };
+
+} // namespace unordered
+} // namespace boost
+
+//
+
+#include <boost/unordered/hash_traits.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/lightweight_test_trait.hpp>
+
+struct X1
+{
+};
+
+struct X2
+{
+    unsigned seed;
+
+    unsigned fingerprint() const { return seed; }
+};
+
+int main()
+{
+    using boost::unordered::hash_fingerprint;
+    using boost::unordered::detail::has_hash_fingerprint;
+
+    BOOST_TEST_TRAIT_FALSE((has_hash_fingerprint<X1>));
+    BOOST_TEST_TRAIT_TRUE((has_hash_fingerprint<X2>));
+    BOOST_TEST_TRAIT_TRUE((has_hash_fingerprint<X3>));
+
+    X2 x2 = { 42 };
+    X3 x3 = { 43 };
+
+    BOOST_TEST_EQ( hash_fingerprint<X2>::get( x2 ), 42u );
+    BOOST_TEST_EQ( hash_fingerprint<X3>::get( x3 ), 43u );
+
+    return boost::report_errors();
+}
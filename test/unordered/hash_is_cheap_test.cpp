@@ -0,0 +1,86 @@
+// Copyright 2026 agent
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// an imitation of a third-party header specializing hash_is_cheap and
+// key_compare_is_cheap
+
+#include <boost/type_traits/integral_constant.hpp>
+
+struct X3
+{
+};
+
+struct P3
+{
+};
+
+namespace boost
+{
+namespace unordered
+{
+
+    template<class Hash> struct hash_is_cheap;
+    template<> struct hash_is_cheap< ::X3 >: boost::true_type {};
+
+    template<class Pred> struct key_compare_is_cheap;
+    template<> struct key_compare_is_cheap< ::P3 >: boost::true_type {};
+
+} // namespace unordered
+} // namespace boost
+
+//
+
+#include <boost/unordered/hash_traits.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <boost/core/lightweight_test_trait.hpp>
+#include <functional>
+#include <string>
+
+struct X1
+{
+};
+
+struct X2
+{
+    typedef void is_cheap;
+};
+
+struct P1
+{
+};
+
+struct P2
+{
+    typedef void is_cheap;
+};
+
+enum E { e0 };
+
+int main()
+{
+    using boost::unordered::hash_is_cheap;
+    using boost::unordered::key_compare_is_cheap;
+
+    BOOST_TEST_TRAIT_FALSE((hash_is_cheap<X1>));
+    BOOST_TEST_TRAIT_TRUE((hash_is_cheap<X2>));
+    BOOST_TEST_TRAIT_TRUE((hash_is_cheap<X3>));
+
+    BOOST_TEST_TRAIT_TRUE((hash_is_cheap< boost::hash<int> >));
+    BOOST_TEST_TRAIT_TRUE((hash_is_cheap< boost::hash<double> >));
+    BOOST_TEST_TRAIT_TRUE((hash_is_cheap< boost::hash<E> >));
+    BOOST_TEST_TRAIT_TRUE((hash_is_cheap< boost::hash<X1*> >));
+    BOOST_TEST_TRAIT_FALSE((hash_is_cheap< boost::hash<std::string> >));
+    BOOST_TEST_TRAIT_TRUE((hash_is_cheap< std::hash<unsigned long> >));
+    BOOST_TEST_TRAIT_FALSE((hash_is_cheap< std::hash<std::string> >));
+
+    BOOST_TEST_TRAIT_FALSE((key_compare_is_cheap<P1>));
+    BOOST_TEST_TRAIT_TRUE((key_compare_is_cheap<P2>));
+    BOOST_TEST_TRAIT_TRUE((key_compare_is_cheap<P3>));
+
+    BOOST_TEST_TRAIT_TRUE((key_compare_is_cheap< std::equal_to<int> >));
+    BOOST_TEST_TRAIT_TRUE((key_compare_is_cheap< std::equal_to<X1*> >));
+    BOOST_TEST_TRAIT_FALSE((key_compare_is_cheap< std::equal_to<std::string> >));
+
+    return boost::report_errors();
+}
@@ -0,0 +1,68 @@
+// Copyright 2026 agent
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/unordered/hash_traits.hpp>
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/lightweight_test_trait.hpp>
+#include <cstdint>
+#include <type_traits>
+
+using boost::unordered::hash_mixing;
+
+struct X1
+{
+};
+
+struct X2
+{
+    static constexpr hash_mixing mixing = hash_mixing::xmx;
+};
+
+template<hash_mixing M> struct mixing_hash: boost::hash<std::uint32_t>
+{
+    static constexpr hash_mixing mixing = M;
+};
+
+template<hash_mixing M> static void test_container()
+{
+    boost::unordered_flat_map<std::uint32_t, std::uint32_t, mixing_hash<M> > m;
+
+    for( std::uint32_t i = 0; i < 10000; ++i )
+    {
+        // low bits only, high bits only, and both
+
+        m.emplace( i, i );
+        m.emplace( ( i + 1 ) << 16, i );
+        m.emplace( ( i + 1 ) << 16 | ( i + 1 ), i );
+    }
+
+    BOOST_TEST_EQ( m.size(), 30000u );
+
+    for( std::uint32_t i = 0; i < 10000; ++i )
+    {
+        BOOST_TEST( m.find( i ) != m.end() );
+        BOOST_TEST( m.find( ( i + 1 ) << 16 ) != m.end() );
+        BOOST_TEST( m.find( ( i + 1 ) << 16 | ( i + 1 ) ) != m.end() );
+    }
+
+    BOOST_TEST( m.find( 10000 ) == m.end() );
+}
+
+int main()
+{
+    using boost::unordered::hash_mixing_policy;
+
+    BOOST_TEST( hash_mixing_policy<X1>::value == hash_mixing::mulx );
+    BOOST_TEST( hash_mixing_policy<X2>::value == hash_mixing::xmx );
+    BOOST_TEST( hash_mixing_policy< boost::hash<std::uint32_t> >::value == hash_mixing::mulx );
+    BOOST_TEST( hash_mixing_policy< mixing_hash<hash_mixing::mulx32> >::value == hash_mixing::mulx32 );
+
+    test_container<hash_mixing::mulx>();
+    test_container<hash_mixing::mulx32>();
+    test_container<hash_mixing::xmx>();
+
+    return boost::report_errors();
+}
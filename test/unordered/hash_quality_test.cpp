@@ -0,0 +1,104 @@
+// Copyright 2026 agent
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define BOOST_UNORDERED_ENABLE_HASH_QUALITY_MONITOR
+
+#include <boost/unordered/hash_quality.hpp>
+#include <boost/unordered/unordered_flat_set.hpp>
+#include <boost/unordered/unordered_node_map.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using boost::unordered::hash_quality_report;
+
+static std::size_t reports = 0;
+static hash_quality_report last_report;
+
+static void handler( hash_quality_report const& r )
+{
+    ++reports;
+    last_report = r;
+}
+
+// identity hash on 16-byte aligned pointers, wrongly declared avalanching
+
+struct pointer_hash
+{
+    typedef void is_avalanching;
+
+    std::size_t operator()( void const* p ) const
+    {
+        return reinterpret_cast<std::uintptr_t>( p );
+    }
+};
+
+// all keys yield the same hash value
+
+struct constant_hash
+{
+    std::size_t operator()( int ) const
+    {
+        return 0;
+    }
+};
+
+int main()
+{
+    BOOST_TEST( boost::unordered::get_hash_quality_handler() != nullptr );
+
+    boost::unordered::set_hash_quality_handler( &handler );
+    BOOST_TEST( boost::unordered::get_hash_quality_handler() == &handler );
+
+    {
+        boost::unordered_flat_set<int> s;
+
+        for( int i = 0; i < 10000; ++i ) s.insert( i );
+
+        BOOST_TEST_EQ( reports, 0u );
+    }
+
+    {
+        std::vector<std::uint64_t> v( 2 * 2000 );
+        boost::unordered_flat_set<void const*, pointer_hash> s;
+
+        for( std::size_t i = 0; i < v.size(); i += 2 ) s.insert( &v[ i ] );
+
+        BOOST_TEST_GT( reports, 0u );
+        BOOST_TEST( last_report.degenerate() );
+        BOOST_TEST_GE( last_report.constant_reduced_hash_bits, 4u );
+        BOOST_TEST_GT( last_report.constant_position_bits, 0u );
+        BOOST_TEST_LE( last_report.size, s.size() );
+        BOOST_TEST_LE( last_report.constant_position_bits, last_report.position_bits );
+    }
+
+    reports = 0;
+
+    {
+        boost::unordered_node_map<int, int, constant_hash> m;
+
+        for( int i = 0; i < 200; ++i ) m.emplace( i, i );
+
+        BOOST_TEST_GT( reports, 0u );
+        BOOST_TEST_EQ( last_report.constant_position_bits, last_report.position_bits );
+        BOOST_TEST_EQ( last_report.constant_reduced_hash_bits, 8u );
+        BOOST_TEST_GT( last_report.displaced * 8, last_report.size );
+        BOOST_TEST_GT( last_report.max_probe_length, 0u );
+    }
+
+    reports = 0;
+    boost::unordered::set_hash_quality_handler( nullptr );
+
+    {
+        boost::unordered_node_map<int, int, constant_hash> m;
+
+        for( int i = 0; i < 200; ++i ) m.emplace( i, i );
+
+        BOOST_TEST_EQ( reports, 0u );
+    }
+
+    return boost::report_errors();
+}
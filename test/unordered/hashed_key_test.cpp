@@ -0,0 +1,169 @@
+// Copyright 2026 agent
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/unordered/hashed_key.hpp>
+#include <boost/unordered/seeded_hash.hpp>
+#include <boost/unordered/string_hash.hpp>
+#include <boost/unordered/unordered_map.hpp>
+#include <boost/unordered/unordered_set.hpp>
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/unordered_node_set.hpp>
+#include <boost/unordered/concurrent_flat_map.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+static std::size_t hash_calls = 0;
+
+struct counting_hash
+{
+    std::size_t operator()( std::string const& x ) const
+    {
+        ++hash_calls;
+        return boost::hash<std::string>()( x );
+    }
+};
+
+struct transparent_equal_to
+{
+    typedef void is_transparent;
+
+    template<class T, class U> bool operator()( T const& x, U const& y ) const
+    {
+        return x == y;
+    }
+};
+
+template<class Map> static void test_map()
+{
+    Map m;
+
+    for( int i = 0; i < 100; ++i )
+    {
+        m.emplace( std::to_string( i ), i );
+    }
+
+    std::string k1 = "42", k2 = "foo";
+    boost::unordered::hashed_key<std::string> hk1( k1, m.hash_function() ), hk2( k2, m.hash_function() );
+
+    hash_calls = 0;
+
+    BOOST_TEST( m.find( hk1 ) != m.end() );
+    BOOST_TEST_EQ( m.find( hk1 )->second, 42 );
+    BOOST_TEST( m.find( hk2 ) == m.end() );
+    BOOST_TEST( m.contains( hk1 ) );
+    BOOST_TEST_EQ( m.count( hk1 ), 1u );
+    BOOST_TEST_EQ( m.count( hk2 ), 0u );
+    BOOST_TEST( m.equal_range( hk1 ).first == m.find( hk1 ) );
+
+    BOOST_TEST_EQ( hash_calls, 0u );
+
+    BOOST_TEST_EQ( m.erase( hk1 ), 1u );
+    BOOST_TEST_EQ( m.erase( hk1 ), 0u );
+    BOOST_TEST_EQ( m.size(), 99u );
+
+    BOOST_TEST_EQ( hash_calls, 0u );
+}
+
+template<class Set> static void test_transparent_set()
+{
+    Set s;
+
+    s.insert( "hello" );
+    s.insert( "world" );
+
+    char const* k = "hello";
+    auto hk = boost::make_hashed_key( k, s.hash_function() );
+
+    BOOST_TEST( s.find( hk ) != s.end() );
+    BOOST_TEST_EQ( *s.find( hk ), "hello" );
+    BOOST_TEST_EQ( s.count( hk ), 1u );
+}
+
+int main()
+{
+    test_map< boost::unordered_map<std::string, int, counting_hash> >();
+    test_map< boost::unordered_multimap<std::string, int, counting_hash> >();
+    test_map< boost::unordered_flat_map<std::string, int, counting_hash> >();
+    test_map< boost::unordered_flat_multimap<std::string, int, counting_hash> >();
+
+    test_transparent_set< boost::unordered_set<std::string, boost::string_hash, transparent_equal_to> >();
+    test_transparent_set< boost::unordered_node_set<std::string, boost::string_hash, transparent_equal_to> >();
+
+    // same hash value used for containers with different mixing seeds
+
+    {
+        typedef boost::unordered::seeded_hash< boost::hash<std::string> > hash;
+
+        boost::unordered_flat_map<std::string, int, hash> m1, m2;
+
+        m1.emplace( "foo", 1 );
+        m2.emplace( "foo", 2 );
+
+        std::string k = "foo";
+        boost::unordered::hashed_key<std::string> hk( k, m1.hash_function() );
+
+        BOOST_TEST_EQ( m1.find( hk )->second, 1 );
+        BOOST_TEST_EQ( m2.find( hk )->second, 2 );
+        BOOST_TEST_EQ( m2.at( hk ), 2 );
+    }
+
+    {
+        boost::unordered_map<std::string, int> m;
+
+        m.emplace( "foo", 1 );
+
+        std::string k = "foo";
+        boost::unordered::hashed_key<std::string> hk( k, m.hash_function() );
+
+        BOOST_TEST_EQ( m.at( hk ), 1 );
+    }
+
+    // concurrent containers
+
+    {
+        boost::concurrent_flat_map<std::string, int, counting_hash> m;
+
+        for( int i = 0; i < 100; ++i )
+        {
+            m.emplace( std::to_string( i ), i );
+        }
+
+        std::vector<std::string> keys;
+
+        for( int i = 0; i < 200; ++i )
+        {
+            keys.push_back( std::to_string( i ) );
+        }
+
+        std::vector< boost::unordered::hashed_key<std::string> > hkeys;
+
+        for( auto const& k: keys )
+        {
+            hkeys.emplace_back( k, m.hash_function() );
+        }
+
+        hash_calls = 0;
+
+        int sum = 0;
+
+        BOOST_TEST_EQ( m.visit( hkeys[ 42 ], [&]( std::pair<std::string const, int> const& x ) { sum += x.second; } ), 1u );
+        BOOST_TEST_EQ( sum, 42 );
+
+        sum = 0;
+
+        BOOST_TEST_EQ( m.cvisit( hkeys.begin(), hkeys.end(), [&]( std::pair<std::string const, int> const& x ) { sum += x.second; } ), 100u );
+        BOOST_TEST_EQ( sum, 99 * 100 / 2 );
+
+        BOOST_TEST( m.contains( hkeys[ 1 ] ) );
+        BOOST_TEST_EQ( m.count( hkeys[ 150 ] ), 0u );
+        BOOST_TEST_EQ( m.erase( hkeys[ 1 ] ), 1u );
+
+        BOOST_TEST_EQ( hash_calls, 0u );
+    }
+
+    return boost::report_errors();
+}
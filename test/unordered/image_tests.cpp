@@ -0,0 +1,309 @@
+// Copyright (C) 2026 agent
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "../helpers/unordered.hpp"
+#include <boost/unordered/unordered_flat_map_view.hpp>
+
+#include "../helpers/test.hpp"
+
+#include <algorithm>
+#include <boost/container_hash/hash.hpp>
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+  struct seeded_hash
+  {
+    std::size_t seed;
+
+    explicit seeded_hash(std::size_t seed_ = 0) : seed(seed_) {}
+
+    std::size_t operator()(int x) const
+    {
+      std::size_t h = seed;
+      boost::hash_combine(h, x);
+      return h;
+    }
+  };
+
+  template <class H> int make_value(boost::unordered_flat_set<int, H>*, int i)
+  {
+    return i;
+  }
+
+  template <class H>
+  std::pair<const int, int> make_value(
+    boost::unordered_flat_map<int, int, H>*, int i)
+  {
+    return {i, -i};
+  }
+
+  template <class X> void fill(X& x, int first, int last)
+  {
+    for (int i = first; i < last; ++i) {
+      x.insert(make_value((X*)0, i));
+    }
+  }
+
+  template <class X> std::string save(X const& x)
+  {
+    std::ostringstream oss;
+    x.save_image(oss);
+    BOOST_TEST(oss.good());
+    return oss.str();
+  }
+
+  template <class X> void check_loaded(X const& x, X const& y)
+  {
+    BOOST_TEST(x == y);
+    BOOST_TEST_EQ(x.size(), y.size());
+    BOOST_TEST_EQ(x.bucket_count(), y.bucket_count());
+    BOOST_TEST_EQ(x.max_load(), y.max_load());
+    BOOST_TEST(std::equal(x.begin(), x.end(), y.begin()));
+  }
+
+  template <class X> void image_tests(X*)
+  {
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "default constructed\n";
+    {
+      X x;
+      X y;
+      fill(y, 0, 100);
+
+      std::istringstream iss(save(x));
+      y.load_image(iss);
+      BOOST_TEST(y.empty());
+      BOOST_TEST(x == y);
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "empty with capacity\n";
+    {
+      X x(1000);
+      X y;
+      std::istringstream iss(save(x));
+      y.load_image(iss);
+      check_loaded(x, y);
+    }
+
+    int const sizes[] = {1, 14, 15, 1000, 50000};
+    for (int n : sizes) {
+      BOOST_LIGHTWEIGHT_TEST_OSTREAM << "size " << n << "\n";
+
+      X x;
+      fill(x, 0, n);
+      x.erase(x.find(n / 2));
+
+      X y;
+      fill(y, -n, 0);
+      std::istringstream iss(save(x));
+      y.load_image(iss);
+      check_loaded(x, y);
+
+      for (int i = 0; i < n; ++i) {
+        BOOST_TEST_EQ(y.count(i), i == n / 2 ? 0u : 1u);
+      }
+
+      // loaded container is fully functional
+      fill(y, n, 2 * n);
+      BOOST_TEST_EQ(y.size(), static_cast<std::size_t>(2 * n - 1));
+      for (int i = 0; i < 2 * n; ++i) {
+        BOOST_TEST_EQ(y.count(i), i == n / 2 ? 0u : 1u);
+      }
+    }
+  }
+
+  template <class X> void hash_mismatch_tests(X*)
+  {
+    int const sizes[] = {1, 1000, 50000};
+    for (int n : sizes) {
+      X x(0, seeded_hash(1));
+      fill(x, 0, n);
+
+      X y(0, seeded_hash(2));
+      std::istringstream iss(save(x));
+      y.load_image(iss);
+
+      // elements are rehashed with y's hash function
+      BOOST_TEST_EQ(y.hash_function().seed, 2u);
+      BOOST_TEST_EQ(y.size(), x.size());
+      BOOST_TEST_EQ(y.bucket_count(), x.bucket_count());
+      for (int i = 0; i < n; ++i) {
+        BOOST_TEST(y.contains(i));
+      }
+      BOOST_TEST(x == y);
+
+      fill(y, n, 2 * n);
+      BOOST_TEST_EQ(y.size(), static_cast<std::size_t>(2 * n));
+    }
+  }
+
+  template <class X> void corrupted_image_tests(X*)
+  {
+    X x;
+    fill(x, 0, 1000);
+    std::string const image = save(x);
+
+    X y;
+    fill(y, -10, 0);
+    X const y0(y);
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "empty stream\n";
+    {
+      std::istringstream iss;
+      BOOST_TEST_THROWS(y.load_image(iss), std::runtime_error);
+      BOOST_TEST(y == y0);
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "truncated stream\n";
+    {
+      std::istringstream iss(image.substr(0, image.size() / 2));
+      BOOST_TEST_THROWS(y.load_image(iss), std::runtime_error);
+      BOOST_TEST(y == y0);
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "bad magic number\n";
+    {
+      std::string bad = image;
+      bad[0] = static_cast<char>(~bad[0]);
+      std::istringstream iss(bad);
+      BOOST_TEST_THROWS(y.load_image(iss), std::runtime_error);
+      BOOST_TEST(y == y0);
+    }
+
+    // metadata encoding and byte order of a different platform
+    for (std::size_t offset : {16u, 20u}) {
+      BOOST_LIGHTWEIGHT_TEST_OSTREAM << "bad format at " << offset << "\n";
+
+      std::string bad = image;
+      bad[offset] = static_cast<char>(bad[offset] ^ 3);
+      std::istringstream iss(bad);
+      BOOST_TEST_THROWS(y.load_image(iss), std::runtime_error);
+      BOOST_TEST(y == y0);
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "bad size\n";
+    {
+      std::string bad = image;
+      bad[24] = static_cast<char>(bad[24] + 1); // low byte of size
+      std::istringstream iss(bad);
+      BOOST_TEST_THROWS(y.load_image(iss), std::runtime_error);
+      BOOST_TEST(y == y0);
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "failed write\n";
+    {
+      std::ostringstream oss;
+      oss.setstate(std::ios_base::badbit);
+      BOOST_TEST_THROWS(x.save_image(oss), std::runtime_error);
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "consecutive images\n";
+    {
+      X z;
+      fill(z, 0, 10);
+      std::istringstream iss(image + save(z));
+      y.load_image(iss);
+      check_loaded(x, y);
+      y.load_image(iss);
+      check_loaded(z, y);
+    }
+  }
+
+  // copies an image into memory aligned as a memory-mapped file would be
+  struct aligned_image
+  {
+    std::vector<char> buf;
+    char* data;
+    std::size_t size;
+
+    explicit aligned_image(std::string const& image, std::size_t offset = 0)
+        : buf(image.size() + 128), size(image.size())
+    {
+      data = &buf[0];
+      data += (64 - reinterpret_cast<std::size_t>(data) % 64) % 64 + offset;
+      std::copy(image.begin(), image.end(), data);
+    }
+  };
+
+  template <class X> void view_tests(X*)
+  {
+    typedef boost::unordered_flat_map_view<int, int, seeded_hash> view_type;
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "default constructed view\n";
+    {
+      view_type v;
+      BOOST_TEST(v.empty());
+      BOOST_TEST_EQ(v.size(), 0u);
+      BOOST_TEST(v.begin() == v.end());
+      BOOST_TEST(v.find(0) == v.end());
+      BOOST_TEST_EQ(v.bucket_count(), 0u);
+    }
+
+    int const sizes[] = {0, 1, 15, 1000, 50000};
+    for (int n : sizes) {
+      BOOST_LIGHTWEIGHT_TEST_OSTREAM << "view of size " << n << "\n";
+
+      X x(0, seeded_hash(7));
+      fill(x, 0, n);
+      aligned_image img(save(x));
+      std::size_t const image_size = img.size;
+
+      view_type v(img.data, image_size, seeded_hash(7));
+      BOOST_TEST_EQ(v.size(), x.size());
+      BOOST_TEST_EQ(v.empty(), x.empty());
+      BOOST_TEST_EQ(v.bucket_count(), x.bucket_count());
+      BOOST_TEST_EQ(v.hash_function().seed, 7u);
+      BOOST_TEST_EQ(
+        static_cast<std::size_t>(std::distance(v.begin(), v.end())), x.size());
+      BOOST_TEST(std::equal(x.begin(), x.end(), v.begin()));
+
+      for (int i = 0; i < n; ++i) {
+        BOOST_TEST(v.contains(i));
+        BOOST_TEST_EQ(v.count(i), 1u);
+        BOOST_TEST_EQ(v.at(i), -i);
+        BOOST_TEST_EQ(v.find(i)->second, -i);
+        std::pair<typename view_type::const_iterator,
+          typename view_type::const_iterator>
+          r = v.equal_range(i);
+        BOOST_TEST_EQ(std::distance(r.first, r.second), 1);
+      }
+      for (int i = n; i < 2 * n + 10; ++i) {
+        BOOST_TEST(!v.contains(i));
+        BOOST_TEST(v.find(i) == v.end());
+        BOOST_TEST_EQ(v.count(i), 0u);
+      }
+      BOOST_TEST_THROWS(v.at(-1), std::out_of_range);
+
+      if (n > 0) {
+        BOOST_TEST_THROWS(
+          view_type(img.data, image_size, seeded_hash(8)), std::runtime_error);
+        BOOST_TEST_THROWS(
+          view_type(img.data, image_size - 1, seeded_hash(7)),
+          std::runtime_error);
+
+        aligned_image misaligned(save(x), 8);
+        BOOST_TEST_THROWS(
+          view_type(misaligned.data, image_size, seeded_hash(7)),
+          std::runtime_error);
+      }
+    }
+  }
+
+  boost::unordered_flat_set<int, seeded_hash>* test_set;
+  boost::unordered_flat_map<int, int, seeded_hash>* test_map;
+
+} // namespace
+
+// clang-format off
+UNORDERED_TEST(image_tests, ((test_set)(test_map)))
+UNORDERED_TEST(hash_mismatch_tests, ((test_set)(test_map)))
+UNORDERED_TEST(corrupted_image_tests, ((test_set)(test_map)))
+UNORDERED_TEST(view_tests, ((test_map)))
+// clang-format on
+
+RUN_TESTS()
@@ -45,9 +45,9 @@ namespace insert_stable
   }
 }
 
-// This is no longer supported, as there's no longer an efficient way to get to
-// the end of a group of equivalent nodes.
-#if 0
+// Only supported when equivalent nodes are grouped, as otherwise there's no
+// efficient way to get to the end of a group of equivalent nodes.
+#if defined(BOOST_UNORDERED_ENABLE_GROUPED_EQUIVALENT_KEYS)
 
 UNORDERED_AUTO_TEST(stable_insert_test1)
 {
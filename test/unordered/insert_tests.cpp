@@ -947,6 +947,75 @@ namespace insert_tests {
     test::check_equivalent_keys(x);
   }
 
+#ifndef BOOST_UNORDERED_FOA_TESTS
+  template <class X>
+  void bulk_insert_tests(X*, test::random_generator generator)
+  {
+    test::check_instances check_;
+
+    UNORDERED_SUB_TEST("bulk_insert(begin(), end())")
+    {
+      X x;
+      test::ordered<X> tracker = test::create_ordered(x);
+
+      test::random_values<X> v(1000, generator);
+      x.bulk_insert(v.begin(), v.end());
+      tracker.insert(v.begin(), v.end());
+
+      tracker.compare(x);
+      test::check_equivalent_keys(x);
+      BOOST_TEST_LE(x.load_factor(), x.max_load_factor());
+    }
+
+    UNORDERED_SUB_TEST("bulk_insert(begin(), end()) into a non-empty container")
+    {
+      test::random_values<X> v1(500, generator), v2(500, generator);
+
+      X x(v1.begin(), v1.end());
+      test::ordered<X> tracker = test::create_ordered(x);
+      tracker.insert(v1.begin(), v1.end());
+
+      x.bulk_insert(v2.begin(), v2.end());
+      tracker.insert(v2.begin(), v2.end());
+
+      tracker.compare(x);
+      test::check_equivalent_keys(x);
+    }
+
+    UNORDERED_SUB_TEST("bulk_insert(begin(), end(), true)")
+    {
+      test::random_values<X> v(1000, generator);
+      X x0(v.begin(), v.end());
+      test::ordered<X> tracker = test::create_ordered(x0);
+      tracker.insert(v.begin(), v.end());
+
+      std::vector<typename X::value_type> unique_values(x0.begin(), x0.end());
+
+      X x;
+      x.bulk_insert(unique_values.begin(), unique_values.end(), true);
+
+      BOOST_TEST(x == x0);
+      tracker.compare(x);
+      test::check_equivalent_keys(x);
+    }
+
+    UNORDERED_SUB_TEST("bulk_insert(input iterators)")
+    {
+      X x;
+      test::ordered<X> tracker = test::create_ordered(x);
+
+      test::random_values<X> v(1000, generator);
+      typename test::random_values<X>::iterator begin = v.begin(),
+                                                end = v.end();
+      x.bulk_insert(test::input_iterator(begin), test::input_iterator(end));
+      tracker.insert(v.begin(), v.end());
+
+      tracker.compare(x);
+      test::check_equivalent_keys(x);
+    }
+  }
+#endif
+
   using test::default_generator;
   using test::generate_collisions;
   using test::limited_range;
@@ -1037,6 +1106,10 @@ namespace insert_tests {
     ((test_multimap_std_alloc)(test_multiset)(test_multimap))(
       (default_generator)(generate_collisions)(limited_range)))
 
+  UNORDERED_TEST(bulk_insert_tests,
+    ((test_set_std_alloc)(test_set)(test_map))(
+      (default_generator)(generate_collisions)(limited_range)))
+
   UNORDERED_TEST(insert_tests2,
     ((test_multimap_std_alloc)(test_set)(test_multiset)(test_map)(test_multimap))(
       (default_generator)(generate_collisions)(limited_range)))
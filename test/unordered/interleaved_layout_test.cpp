@@ -0,0 +1,250 @@
+// Copyright 2026 agent
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/unordered_flat_set.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <utility>
+
+// 12 bytes, so that group+slots blocks need padding
+
+struct triple
+{
+    std::uint32_t a = 0, b = 0, c = 0;
+
+    triple() = default;
+    explicit triple( std::uint32_t x ): a( x ), b( x + 1 ), c( x + 2 ) {}
+
+    friend bool operator==( triple const& x, triple const& y )
+    {
+        return x.a == y.a && x.b == y.b && x.c == y.c;
+    }
+};
+
+namespace boost
+{
+namespace unordered
+{
+
+template<> struct flat_map_interleaved_layout<std::uint32_t, std::uint32_t>: std::true_type
+{
+};
+
+template<> struct flat_map_interleaved_layout<std::uint32_t, triple>: std::true_type
+{
+};
+
+template<> struct flat_set_interleaved_layout<std::uint64_t>: std::true_type
+{
+};
+
+} // namespace unordered
+} // namespace boost
+
+// few distinct reduced hashes and positions, to exercise tag collisions and overflow
+
+struct poor_hash
+{
+    std::size_t operator()( std::uint64_t x ) const
+    {
+        return static_cast<std::size_t>( ( x % 61 ) * 0x9E3779B97F4A7C15ull );
+    }
+};
+
+static std::uint32_t mapped_from( std::uint32_t k, std::uint32_t* )
+{
+    return k ^ 0x5555u;
+}
+
+static triple mapped_from( std::uint32_t k, triple* )
+{
+    return triple( k );
+}
+
+template<class Map> static void check( Map const& m, std::map<std::uint32_t, typename Map::mapped_type> const& ref )
+{
+    BOOST_TEST_EQ( m.size(), ref.size() );
+
+    for( auto const& x: ref )
+    {
+        auto it = m.find( x.first );
+
+        if( BOOST_TEST( it != m.end() ) )
+        {
+            BOOST_TEST_EQ( it->first, x.first );
+            BOOST_TEST( it->second == x.second );
+        }
+    }
+
+    std::size_t n = 0;
+
+    for( auto const& x: m )
+    {
+        BOOST_TEST_EQ( ref.count( x.first ), 1u );
+        ++n;
+    }
+
+    BOOST_TEST_EQ( n, ref.size() );
+}
+
+template<class Map> static void test_map()
+{
+    using mapped_type = typename Map::mapped_type;
+
+    auto mapped = []( std::uint32_t k ) { return mapped_from( k, static_cast<mapped_type*>( nullptr ) ); };
+
+    Map m;
+    std::map<std::uint32_t, mapped_type> ref;
+
+    BOOST_TEST( m.begin() == m.end() );
+    BOOST_TEST( m.find( 0 ) == m.end() );
+
+    for( std::uint32_t i = 0; i < 3000; ++i )
+    {
+        std::uint32_t k = i * 7919;
+
+        if( i % 3 == 0 ) m.emplace( k, mapped( k ) );
+        else if( i % 3 == 1 ) m.try_emplace( k, mapped( k ) );
+        else m[ k ] = mapped( k );
+
+        ref.emplace( k, mapped( k ) );
+    }
+
+    check( m, ref );
+
+    BOOST_TEST( m.find( 1 ) == m.end() );
+    BOOST_TEST( !m.try_emplace( 0, mapped( 1 ) ).second );
+
+    for( std::uint32_t i = 0; i < 3000; i += 2 )
+    {
+        std::uint32_t k = i * 7919;
+
+        if( i % 4 == 0 ) BOOST_TEST_EQ( m.erase( k ), 1u );
+        else m.erase( m.find( k ) );
+
+        ref.erase( k );
+    }
+
+    check( m, ref );
+
+    // erase while iterating
+
+    for( auto it = m.begin(); it != m.end(); )
+    {
+        if( it->first % 3 == 0 )
+        {
+            ref.erase( it->first );
+            it = m.erase( it );
+        }
+        else ++it;
+    }
+
+    check( m, ref );
+
+    m.rehash( 0 );
+    check( m, ref );
+
+    m.reserve( 20000 );
+    check( m, ref );
+
+    Map m2( m );
+    check( m2, ref );
+
+    Map m3;
+    m3.emplace( 1, mapped( 1 ) );
+    m3 = m;
+    check( m3, ref );
+
+    Map m4( std::move( m3 ) );
+    check( m4, ref );
+
+    Map m5;
+    m5.swap( m4 );
+    check( m5, ref );
+    BOOST_TEST( m4.empty() );
+
+    Map m6;
+
+    for( std::uint32_t i = 0; i < 1000; ++i )
+    {
+        m6.emplace( i, mapped( i ) );
+    }
+
+    std::map<std::uint32_t, mapped_type> ref2( ref );
+
+    for( std::uint32_t i = 0; i < 1000; ++i )
+    {
+        ref2.emplace( i, mapped( i ) );
+    }
+
+    m5.merge( m6 );
+    check( m5, ref2 );
+
+    m5.clear();
+    BOOST_TEST( m5.empty() );
+    BOOST_TEST( m5.begin() == m5.end() );
+    BOOST_TEST( m5.find( 0 ) == m5.end() );
+
+    m5.emplace( 0, mapped( 0 ) );
+    BOOST_TEST( m5.contains( 0 ) );
+}
+
+template<class Set> static void test_set()
+{
+    Set s;
+    std::set<std::uint64_t> ref;
+
+    for( std::uint64_t i = 0; i < 3000; ++i )
+    {
+        s.insert( i * 31 );
+        ref.insert( i * 31 );
+    }
+
+    for( std::uint64_t i = 0; i < 3000; i += 3 )
+    {
+        s.erase( i * 31 );
+        ref.erase( i * 31 );
+    }
+
+    Set s2( s );
+    s2.rehash( 10000 );
+
+    for( Set const* ps: { &s, &s2 } )
+    {
+        BOOST_TEST_EQ( ps->size(), ref.size() );
+
+        for( auto x: ref )
+        {
+            BOOST_TEST( ps->contains( x ) );
+            BOOST_TEST( !ps->contains( x + 1 ) );
+        }
+
+        std::size_t n = 0;
+
+        for( auto x: *ps )
+        {
+            BOOST_TEST_EQ( ref.count( x ), 1u );
+            ++n;
+        }
+
+        BOOST_TEST_EQ( n, ref.size() );
+    }
+
+    BOOST_TEST( s == s2 );
+}
+
+int main()
+{
+    test_map< boost::unordered_flat_map<std::uint32_t, std::uint32_t> >();
+    test_map< boost::unordered_flat_map<std::uint32_t, std::uint32_t, poor_hash> >();
+    test_map< boost::unordered_flat_map<std::uint32_t, triple> >();
+    test_set< boost::unordered_flat_set<std::uint64_t> >();
+    test_set< boost::unordered_flat_set<std::uint64_t, poor_hash> >();
+
+    return boost::report_errors();
+}
@@ -232,6 +232,46 @@ namespace merge_tests {
   using test::generate_collisions;
 
 #ifdef BOOST_UNORDERED_FOA_TESTS
+  // Containers with the same capacity and stateless hasher take a merge
+  // path that doesn't recalculate hash values.
+
+  template <class X>
+  void merge_same_layout_test(X*, test::random_generator generator)
+  {
+    test::random_values<X> v1(1000, generator);
+    test::random_values<X> v2(1000, generator);
+
+    X x1, x2, x3;
+    x1.reserve(2000);
+    x2.reserve(2000);
+    x3.reserve(2000);
+
+    x2.insert(v2.begin(), v2.end());
+    BOOST_TEST_EQ(x1.bucket_count(), x2.bucket_count());
+    x1.merge(x2);
+    BOOST_TEST(x2.empty());
+    test::check_container(x1, v2);
+
+    x3.insert(v1.begin(), v1.end());
+    BOOST_TEST_EQ(x1.bucket_count(), x3.bucket_count());
+    test::ordered<X> tracker = test::create_ordered(x3);
+    tracker.insert_range(x3.begin(), x3.end());
+    tracker.insert_range(x1.begin(), x1.end());
+    x3.merge(x1);
+    tracker.compare(x3);
+
+    for (typename X::iterator it = x3.begin(); it != x3.end(); ++it) {
+      BOOST_TEST(x3.find(*it) != x3.end());
+      BOOST_TEST_EQ(x3.count(*it), tracker.count(*it));
+    }
+
+    while (!x3.empty()) {
+      typename X::value_type key = *x3.begin();
+      BOOST_TEST_EQ(x3.erase(key), tracker.erase(key));
+      BOOST_TEST(x3.find(key) == x3.end());
+    }
+  }
+
   boost::unordered_flat_set<int>* int_set;
 
   boost::unordered_flat_set<test::movable, test::hash, test::equal_to,
@@ -246,9 +286,15 @@ namespace merge_tests {
   boost::unordered_flat_map<test::movable, test::movable, test::hash,
     test::equal_to, test::allocator2<test::movable> >* test_map;
 
+  boost::unordered_flat_multiset<int>* int_multiset;
+
   // clang-format off
 UNORDERED_TEST(merge_set, ((int_set)))
 
+UNORDERED_TEST(merge_same_layout_test,
+    ((int_set)(int_multiset))
+    ((default_generator)(generate_collisions)))
+
 UNORDERED_TEST(merge_empty_test,
     ((test_set_std_alloc))
     ((test_set_std_alloc))
@@ -319,9 +365,15 @@ UNORDERED_TEST(merge_into_unique_keys_test,
   boost::unordered_node_map<test::movable, test::movable, test::hash,
     test::equal_to, test::allocator2<test::movable> >* test_node_map;
 
+  boost::unordered_node_multiset<int>* int_node_multiset;
+
   // clang-format off
 UNORDERED_TEST(merge_set, ((int_node_set)))
 
+UNORDERED_TEST(merge_same_layout_test,
+    ((int_node_set)(int_node_multiset))
+    ((default_generator)(generate_collisions)))
+
 UNORDERED_TEST(merge_empty_test,
     ((test_node_set_std_alloc))
     ((test_node_set_std_alloc))
@@ -0,0 +1,361 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Tests for unordered_(flat|node)_multi(set|map). Equivalent elements are not
+// adjacent in iteration order for these containers, so the generic
+// test::check_equivalent_keys invariant doesn't apply and equal_range returns
+// a dedicated iterator type.
+
+#include "../helpers/unordered.hpp"
+
+#include "../helpers/test.hpp"
+#include "../objects/test.hpp"
+#include "../helpers/random_values.hpp"
+#include "../helpers/tracker.hpp"
+#include "../helpers/equivalent.hpp"
+#include "../helpers/helpers.hpp"
+
+#include <map>
+#include <utility>
+
+namespace multi_tests {
+
+  test::seed_t initialize_seed(47295);
+
+  template <class X> void check_equal_ranges(X const& x)
+  {
+    typename X::size_type size = 0;
+    for (typename X::const_iterator it = x.begin(); it != x.end(); ++it) {
+      typename X::key_type const& key = test::get_key<X>(*it);
+      typename X::size_type count = 0;
+      bool found = false;
+
+      std::pair<typename X::const_equal_range_iterator,
+        typename X::const_equal_range_iterator>
+        r = x.equal_range(key);
+      for (; r.first != r.second; ++r.first) {
+        BOOST_TEST(x.key_eq()(key, test::get_key<X>(*r.first)));
+        if (&*r.first == &*it)
+          found = true;
+        ++count;
+      }
+
+      BOOST_TEST(found);
+      BOOST_TEST_EQ(x.count(key), count);
+      BOOST_TEST(x.contains(key));
+      BOOST_TEST(x.find(key) != x.end());
+      ++size;
+    }
+    BOOST_TEST_EQ(x.size(), size);
+  }
+
+  template <class X> void insert_tests(X*, test::random_generator generator)
+  {
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "insert(value_type const&).\n";
+    {
+      test::check_instances check_;
+
+      test::random_values<X> v(1000, generator);
+      X x;
+      test::ordered<X> tracker = test::create_ordered(x);
+
+      for (typename test::random_values<X>::iterator it = v.begin();
+           it != v.end(); ++it) {
+        typename X::size_type old_count = x.count(test::get_key<X>(*it));
+        typename X::iterator pos = x.insert(*it);
+        tracker.insert(*it);
+
+        BOOST_TEST(*pos == *it);
+        BOOST_TEST_EQ(x.count(test::get_key<X>(*it)), old_count + 1);
+        tracker.compare_key(x, *it);
+      }
+
+      tracker.compare(x);
+      check_equal_ranges(x);
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "emplace/insert(first, last).\n";
+    {
+      test::check_instances check_;
+
+      test::random_values<X> v(1000, generator);
+      X x(v.begin(), v.end());
+      X y;
+      for (typename test::random_values<X>::iterator it = v.begin();
+           it != v.end(); ++it) {
+        y.emplace_hint(y.end(), *it);
+      }
+      x.insert(v.begin(), v.end());
+      y.insert(v.begin(), v.end());
+
+      test::ordered<X> tracker = test::create_ordered(x);
+      tracker.insert_range(v.begin(), v.end());
+      tracker.insert_range(v.begin(), v.end());
+      tracker.compare(x);
+      tracker.compare(y);
+      BOOST_TEST(x == y);
+      check_equal_ranges(x);
+    }
+  }
+
+  template <class X> void erase_tests(X*, test::random_generator generator)
+  {
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "erase(key).\n";
+    {
+      test::check_instances check_;
+
+      test::random_values<X> v(1000, generator);
+      X x(v.begin(), v.end());
+      test::ordered<X> tracker = test::create_ordered(x);
+      tracker.insert_range(v.begin(), v.end());
+
+      int iterations = 0;
+      for (typename test::random_values<X>::iterator it = v.begin();
+           it != v.end(); ++it) {
+        typename X::key_type key = test::get_key<X>(*it);
+        std::size_t count = tracker.erase(key);
+        std::size_t old_size = x.size();
+        BOOST_TEST_EQ(x.erase(key), count);
+        BOOST_TEST_EQ(x.size(), old_size - count);
+        BOOST_TEST_EQ(x.count(key), 0u);
+        BOOST_TEST(x.find(key) == x.end());
+        if (++iterations % 20 == 0) {
+          tracker.compare(x);
+          check_equal_ranges(x);
+        }
+      }
+      BOOST_TEST(x.empty());
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "erase(key) with key from container.\n";
+    {
+      test::check_instances check_;
+
+      test::random_values<X> v(1000, generator);
+      X x(v.begin(), v.end());
+      test::ordered<X> tracker = test::create_ordered(x);
+      tracker.insert_range(v.begin(), v.end());
+
+      while (!x.empty()) {
+        typename X::key_type key = test::get_key<X>(*x.begin());
+        std::size_t count = tracker.erase(key);
+        BOOST_TEST_EQ(x.erase(test::get_key<X>(*x.begin())), count);
+      }
+      BOOST_TEST(tracker.empty());
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "erase(equal_range_iterator).\n";
+    {
+      test::check_instances check_;
+
+      test::random_values<X> v(1000, generator);
+      X x(v.begin(), v.end());
+      test::ordered<X> tracker = test::create_ordered(x);
+      tracker.insert_range(v.begin(), v.end());
+
+      for (typename test::random_values<X>::iterator it = v.begin();
+           it != v.end(); ++it) {
+        typename X::key_type key = test::get_key<X>(*it);
+        std::size_t count = 0;
+
+        std::pair<typename X::equal_range_iterator,
+          typename X::equal_range_iterator>
+          r = x.equal_range(key);
+        while (r.first != r.second) {
+          typename X::const_iterator pos = r.first++;
+          x.erase(pos);
+          ++count;
+        }
+        BOOST_TEST_EQ(count, tracker.erase(key));
+        BOOST_TEST_EQ(x.count(key), 0u);
+      }
+      BOOST_TEST(x.empty());
+    }
+  }
+
+  template <class X>
+  void copy_equality_tests(X*, test::random_generator generator)
+  {
+    test::check_instances check_;
+
+    test::random_values<X> v(1000, generator);
+    X x(v.begin(), v.end());
+    X y(x);
+    BOOST_TEST(x == y);
+    BOOST_TEST(!(x != y));
+
+    y.rehash(y.bucket_count() * 4);
+    BOOST_TEST(x == y);
+    check_equal_ranges(y);
+
+    if (!v.empty()) {
+      y.insert(*v.begin());
+      BOOST_TEST(x != y);
+      y.erase(y.find(test::get_key<X>(*v.begin())));
+      BOOST_TEST(x == y);
+      y.erase(test::get_key<X>(*v.begin()));
+      BOOST_TEST(x != y);
+    }
+
+    // merging a container into itself leaves it unchanged
+    X w(x);
+    w.merge(w);
+    BOOST_TEST(w == x);
+    w.merge(std::move(w));
+    BOOST_TEST(w == x);
+    check_equal_ranges(w);
+
+    X z;
+    z.merge(x);
+    BOOST_TEST(x.empty());
+    test::ordered<X> tracker = test::create_ordered(z);
+    tracker.insert_range(v.begin(), v.end());
+    tracker.compare(z);
+    check_equal_ranges(z);
+  }
+
+  // Stateless, so that merging into a container of the same capacity
+  // transfers elements to their positions without rehashing them. N!=0
+  // produces few distinct hash values, so that groups overflow.
+  template <int N> struct counting_hash
+  {
+    static bool const collides = N != 0;
+    static std::size_t calls;
+
+    std::size_t operator()(int x) const
+    {
+      ++calls;
+      return boost::hash<int>()(N ? x % N : x);
+    }
+  };
+
+  template <int N> std::size_t counting_hash<N>::calls = 0;
+
+  int make_merge_value(int*, int k, int) { return k; }
+
+  std::pair<int const, int> make_merge_value(
+    std::pair<int const, int>*, int k, int v)
+  {
+    return std::pair<int const, int>(k, v);
+  }
+
+  template <class X> void layout_merge_tests(X*)
+  {
+    typedef typename X::value_type value_type;
+    typedef typename X::hasher hasher;
+
+    X x, y;
+    x.reserve(1000);
+    y.reserve(1000);
+    BOOST_TEST_EQ(x.bucket_count(), y.bucket_count());
+
+    std::map<int, std::size_t> counts;
+    for (int i = 0; i < 300; ++i) {
+      x.insert(make_merge_value((value_type*)0, i % 100, i));
+      y.insert(make_merge_value((value_type*)0, i % 150, -i));
+      ++counts[i % 100];
+      ++counts[i % 150];
+    }
+
+    std::size_t bucket_count = x.bucket_count();
+    hasher::calls = 0;
+    x.merge(y);
+    if (hasher::collides) {
+      // elements whose group is full are inserted the regular way
+      BOOST_TEST_LE(hasher::calls, 300u);
+    } else {
+      BOOST_TEST_EQ(hasher::calls, 0u);
+    }
+    BOOST_TEST(y.empty());
+    BOOST_TEST_EQ(x.bucket_count(), bucket_count);
+    BOOST_TEST_EQ(x.size(), 600u);
+    for (std::map<int, std::size_t>::iterator it = counts.begin();
+         it != counts.end(); ++it) {
+      BOOST_TEST_EQ(x.count(it->first), it->second);
+    }
+    check_equal_ranges(x);
+
+    // elements are still found after growing
+    x.rehash(x.bucket_count() * 2);
+    for (std::map<int, std::size_t>::iterator it = counts.begin();
+         it != counts.end(); ++it) {
+      BOOST_TEST_EQ(x.count(it->first), it->second);
+    }
+  }
+
+  template <class X> void node_handle_tests(X*, test::random_generator)
+  {
+    typedef typename X::node_type node_type;
+
+    test::check_instances check_;
+
+    test::random_values<X> v(100, test::generate_collisions);
+    X x(v.begin(), v.end());
+    X y;
+    test::ordered<X> tracker = test::create_ordered(x);
+    tracker.insert_range(v.begin(), v.end());
+
+    while (!x.empty()) {
+      typename X::key_type key = test::get_key<X>(*x.begin());
+      std::size_t count = x.count(key);
+      node_type nh = x.extract(key);
+      BOOST_TEST(!nh.empty());
+      BOOST_TEST_EQ(x.count(key), count - 1);
+      typename X::iterator pos = y.insert(std::move(nh));
+      BOOST_TEST(nh.empty());
+      BOOST_TEST(x.key_eq()(key, test::get_key<X>(*pos)));
+    }
+    tracker.compare(y);
+    check_equal_ranges(y);
+
+    node_type nh;
+    BOOST_TEST(y.insert(std::move(nh)) == y.end());
+  }
+
+  using test::default_generator;
+  using test::generate_collisions;
+  using test::limited_range;
+
+  boost::unordered_flat_multiset<test::object, test::hash, test::equal_to,
+    test::allocator1<test::object> >* test_set;
+  boost::unordered_flat_multimap<test::object, test::object, test::hash,
+    test::equal_to, test::allocator1<test::object> >* test_map;
+  boost::unordered_node_multiset<test::object, test::hash, test::equal_to,
+    test::allocator1<test::object> >* test_node_set;
+  boost::unordered_node_multimap<test::object, test::object, test::hash,
+    test::equal_to, test::allocator1<test::object> >* test_node_map;
+
+  // clang-format off
+  UNORDERED_TEST(
+    insert_tests, ((test_set)(test_map)(test_node_set)(test_node_map))(
+                    (default_generator)(generate_collisions)(limited_range)))
+
+  UNORDERED_TEST(
+    erase_tests, ((test_set)(test_map)(test_node_set)(test_node_map))(
+                   (default_generator)(generate_collisions)(limited_range)))
+
+  UNORDERED_TEST(
+    copy_equality_tests, ((test_set)(test_map)(test_node_set)(test_node_map))(
+                           (default_generator)(generate_collisions)(limited_range)))
+
+  UNORDERED_TEST(
+    node_handle_tests, ((test_node_set)(test_node_map))((default_generator)))
+  // clang-format on
+
+  boost::unordered_flat_multiset<int, counting_hash<0> >* test_int_set;
+  boost::unordered_flat_multimap<int, int, counting_hash<0> >* test_int_map;
+  boost::unordered_node_multiset<int, counting_hash<0> >* test_int_node_set;
+  boost::unordered_node_multimap<int, int, counting_hash<0> >*
+    test_int_node_map;
+  boost::unordered_flat_multimap<int, int, counting_hash<7> >*
+    test_int_collision_map;
+
+  // clang-format off
+  UNORDERED_TEST(
+    layout_merge_tests, ((test_int_set)(test_int_map)(test_int_node_set)
+                         (test_int_node_map)(test_int_collision_map)))
+  // clang-format on
+} // namespace multi_tests
+
+RUN_TESTS()
@@ -0,0 +1,111 @@
+// Copyright 2026 agent
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/unordered/seeded_hash.hpp>
+#include <boost/unordered/string_hash.hpp>
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/unordered_flat_set.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/lightweight_test_trait.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using boost::unordered::hash_mixing;
+using boost::unordered::seeded_hash;
+
+struct transparent_equal_to
+{
+    typedef void is_transparent;
+
+    template<class T, class U> bool operator()( T const& x, U const& y ) const
+    {
+        return x == y;
+    }
+};
+
+int main()
+{
+    using boost::unordered::hash_mixing_policy;
+    using boost::unordered::hash_is_cheap;
+    using boost::unordered::detail::has_hash_batch;
+    using boost::unordered::detail::has_hash_fingerprint;
+
+    typedef seeded_hash< boost::hash<int> > int_hash;
+    typedef seeded_hash< boost::string_hash > str_hash;
+
+    BOOST_TEST( hash_mixing_policy<int_hash>::value == hash_mixing::seeded_mulx );
+    BOOST_TEST_TRAIT_TRUE(( hash_is_cheap<int_hash> ));
+    BOOST_TEST_TRAIT_FALSE(( has_hash_fingerprint<int_hash> ));
+    BOOST_TEST_TRAIT_FALSE(( has_hash_batch<int_hash, int const*> ));
+    BOOST_TEST_TRAIT_TRUE(( has_hash_fingerprint<str_hash> ));
+    BOOST_TEST_TRAIT_TRUE(( boost::unordered::detail::is_transparent<str_hash> ));
+
+    // hash values are those of the wrapped hash function
+
+    {
+        int_hash h1, h2;
+
+        BOOST_TEST_NE( h1.seed(), h2.seed() );
+        BOOST_TEST_EQ( h1( 42 ), boost::hash<int>()( 42 ) );
+        BOOST_TEST_EQ( h2( 42 ), boost::hash<int>()( 42 ) );
+    }
+
+    {
+        str_hash h1( boost::string_hash(), 1 ), h2( boost::string_hash(), 1 ), h3( boost::string_hash(), 2 );
+
+        BOOST_TEST_EQ( h1.fingerprint(), h2.fingerprint() );
+        BOOST_TEST_NE( h1.fingerprint(), h3.fingerprint() );
+    }
+
+    // containers with different seeds lay out the same keys differently;
+    // the seed is kept on copy and exchanged on swap
+
+    {
+        boost::unordered_flat_set<int, int_hash> s1, s2;
+
+        for( int i = 0; i < 1000; ++i )
+        {
+            s1.insert( i );
+            s2.insert( i );
+        }
+
+        BOOST_TEST( s1 == s2 );
+        BOOST_TEST( !std::equal( s1.begin(), s1.end(), s2.begin() ) );
+
+        boost::unordered_flat_set<int, int_hash> s3( s1 );
+
+        BOOST_TEST_EQ( s3.hash_function().seed(), s1.hash_function().seed() );
+        BOOST_TEST( std::equal( s1.begin(), s1.end(), s3.begin() ) );
+
+        std::uint64_t seed1 = s1.hash_function().seed(), seed2 = s2.hash_function().seed();
+
+        s1.swap( s2 );
+
+        BOOST_TEST_EQ( s1.hash_function().seed(), seed2 );
+        BOOST_TEST_EQ( s2.hash_function().seed(), seed1 );
+
+        std::vector<int> v( s1.begin(), s1.end() );
+        s1.clear();
+        s1.insert( v.begin(), v.end() );
+
+        BOOST_TEST( s1 == s3 );
+    }
+
+    // heterogeneous lookup
+
+    {
+        boost::unordered_flat_map<std::string, int, str_hash, transparent_equal_to > m;
+
+        m.emplace( "foo", 1 );
+        m.emplace( "bar", 2 );
+
+        BOOST_TEST_EQ( m.count( "foo" ), 1u );
+        BOOST_TEST( m.find( "baz" ) == m.end() );
+    }
+
+    return boost::report_errors();
+}
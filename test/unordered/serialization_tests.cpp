@@ -11,6 +11,7 @@
 
 #include "../objects/test.hpp"
 #include "../helpers/random_values.hpp"
+#include "../helpers/helpers.hpp"
 
 #include <algorithm>
 #include <boost/archive/text_oarchive.hpp>
@@ -23,9 +24,15 @@
 #include <boost/serialization/string.hpp>
 #include <boost/serialization/utility.hpp>
 #include <boost/serialization/vector.hpp>
+#include <boost/unordered/async_serialization.hpp>
+#include <boost/unordered/seeded_hash.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 
 #include <random>
 
@@ -111,10 +118,377 @@ namespace {
     }
   }
 
+#ifdef BOOST_UNORDERED_FOA_TESTS
+  std::pair<const std::int64_t, std::uint32_t> make_compact_value(
+    std::pair<const std::int64_t, std::uint32_t>*, std::uint64_t x)
+  {
+    return std::pair<const std::int64_t, std::uint32_t>(
+      static_cast<std::int64_t>(x), static_cast<std::uint32_t>(x >> 40));
+  }
+
+  std::int32_t make_compact_value(std::int32_t*, std::uint64_t x)
+  {
+    return static_cast<std::int32_t>(x);
+  }
+
+  template <class Container, typename ArchivePair>
+  void layout_serialization_tests(
+    Container*, ArchivePair*, test::random_generator generator)
+  {
+    typedef typename Container::iterator      iterator;
+    typedef std::vector<iterator>             iterator_vector;
+    typedef typename ArchivePair::first_type  output_archive;
+    typedef typename ArchivePair::second_type input_archive;
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "layout_serialization_tests1\n";
+    {
+      Container c;
+
+      std::ostringstream oss;
+      {
+        output_archive oa(oss);
+        c.save_layout(oa);
+      }
+
+      test::random_values<Container> values(100, generator);
+      Container c2(values.begin(), values.end());
+      std::istringstream iss(oss.str());
+      input_archive ia(iss);
+      c2.load_layout(ia);
+      BOOST_TEST(c2.empty());
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "layout_serialization_tests2\n";
+    {
+      test::random_values<Container> values(1000, generator);
+      Container c(values.begin(), values.end());
+      c.erase(c.begin());
+
+      iterator_vector v;
+      for (iterator first = c.begin(), last = c.end(); first != last;
+           ++first) {
+        v.push_back(first);
+      }
+      std::shuffle(v.begin(), v.end(), std::mt19937(4213));
+
+      std::ostringstream oss;
+      {
+        output_archive oa(oss);
+        c.save_layout(oa);
+        oa << boost::serialization::make_nvp("iterators", v);
+      }
+
+      test::random_values<Container> values2(10, generator);
+      Container c2(values2.begin(), values2.end());
+      iterator_vector v2;
+      std::istringstream iss(oss.str());
+      input_archive ia(iss);
+      c2.load_layout(ia);
+      ia >> boost::serialization::make_nvp("iterators", v2);
+
+      // elements are restored at their original positions
+      BOOST_TEST(c == c2);
+      BOOST_TEST_EQ(c.bucket_count(), c2.bucket_count());
+      BOOST_TEST(std::equal(c.begin(), c.end(), c2.begin()));
+      BOOST_TEST_EQ(v.size(), v2.size());
+      for (std::size_t i = 0; i < v.size(); ++i) {
+        BOOST_TEST(*v[i] == *v2[i]);
+      }
+
+      test::random_values<Container> values3(1000, generator);
+      c2.insert(values3.begin(), values3.end());
+      for (iterator first = c.begin(), last = c.end(); first != last;
+           ++first) {
+        BOOST_TEST(c2.find(test::get_key<Container>(*first)) != c2.end());
+      }
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "layout_serialization_tests3\n";
+    {
+      test::random_values<Container> values(1000, generator);
+      Container c(values.begin(), values.end());
+
+      std::ostringstream oss;
+      {
+        output_archive oa(oss);
+        c.save_layout(oa);
+      }
+
+      // different hash function: elements are inserted the regular way
+      Container c2(0, test::hash(1));
+      std::istringstream iss(oss.str());
+      input_archive ia(iss);
+      c2.load_layout(ia);
+      BOOST_TEST(c == c2);
+      BOOST_TEST_EQ(c.bucket_count(), c2.bucket_count());
+    }
+  }
+
+  // hash function with a seed-based fingerprint, counting its invocations
+  struct fingerprinted_hash
+  {
+    std::uint64_t seed;
+    std::size_t* calls;
+
+    std::size_t operator()(int x) const
+    {
+      ++*calls;
+      return boost::hash<int>()(x) ^ static_cast<std::size_t>(seed);
+    }
+
+    std::uint64_t fingerprint() const { return seed; }
+  };
+
+  // same hash function without a fingerprint
+  struct unfingerprinted_hash
+  {
+    std::size_t* calls;
+
+    std::size_t operator()(int x) const
+    {
+      ++*calls;
+      return boost::hash<int>()(x) ^ 1u;
+    }
+  };
+
+  struct cheap_unfingerprinted_hash : unfingerprinted_hash
+  {
+    typedef void is_cheap;
+  };
+
+  template <typename ArchivePair>
+  void fingerprint_layout_serialization_tests(ArchivePair*)
+  {
+    typedef boost::unordered_flat_map<int, int, fingerprinted_hash> container;
+    typedef typename ArchivePair::first_type  output_archive;
+    typedef typename ArchivePair::second_type input_archive;
+
+    std::size_t calls = 0;
+    fingerprinted_hash h1 = {1, &calls}, h2 = {2, &calls};
+
+    container c(0, h1);
+    for (int i = 0; i < 1000; ++i) {
+      c.emplace(i * 7, i);
+    }
+
+    std::ostringstream oss;
+    {
+      output_archive oa(oss);
+      c.save_layout(oa);
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM
+      << "fingerprint_layout_serialization_tests1\n";
+    {
+      // same fingerprint: hash values are not checked
+      container c2(0, h1);
+      std::istringstream iss(oss.str());
+      input_archive ia(iss);
+      calls = 0;
+      c2.load_layout(ia);
+      BOOST_TEST_EQ(calls, 0u);
+      BOOST_TEST(c == c2);
+      BOOST_TEST(std::equal(c.begin(), c.end(), c2.begin()));
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM
+      << "fingerprint_layout_serialization_tests2\n";
+    {
+      // different fingerprint: all elements are rehashed
+      container c2(0, h2);
+      std::istringstream iss(oss.str());
+      input_archive ia(iss);
+      calls = 0;
+      c2.load_layout(ia);
+      BOOST_TEST_GE(calls, c.size());
+      BOOST_TEST(c == c2);
+      BOOST_TEST_EQ(c.bucket_count(), c2.bucket_count());
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM
+      << "fingerprint_layout_serialization_tests3\n";
+    {
+      // no fingerprint on the loading side: hash function is sampled
+      typedef boost::unordered_flat_map<int, int> container2;
+
+      container2 c2;
+      std::istringstream iss(oss.str());
+      input_archive ia(iss);
+      c2.load_layout(ia);
+      BOOST_TEST_EQ(c.size(), c2.size());
+      for (int i = 0; i < 1000; ++i) {
+        BOOST_TEST(c2.find(i * 7) != c2.end());
+      }
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM
+      << "fingerprint_layout_serialization_tests4\n";
+    {
+      // no fingerprint on the loading side: only a sample of hash values is
+      // checked, unless the hash function is cheap
+      typedef boost::unordered_flat_map<int, int, unfingerprinted_hash>
+        container2;
+      typedef boost::unordered_flat_map<int, int, cheap_unfingerprinted_hash>
+        container3;
+
+      unfingerprinted_hash       h3 = {&calls};
+      cheap_unfingerprinted_hash h4;
+      h4.calls = &calls;
+
+      container2 c2(0, h3);
+      container3 c3(0, h4);
+      {
+        std::istringstream iss(oss.str());
+        input_archive ia(iss);
+        calls = 0;
+        c2.load_layout(ia);
+        BOOST_TEST_EQ(calls, 16u);
+      }
+      {
+        std::istringstream iss(oss.str());
+        input_archive ia(iss);
+        calls = 0;
+        c3.load_layout(ia);
+        BOOST_TEST_EQ(calls, c.size());
+      }
+      BOOST_TEST(std::equal(c.begin(), c.end(), c2.begin()));
+      BOOST_TEST(std::equal(c.begin(), c.end(), c3.begin()));
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM
+      << "fingerprint_layout_serialization_tests5\n";
+    {
+      // seeded mixing: the seed is part of the fingerprint
+      typedef boost::unordered::seeded_hash<fingerprinted_hash> seeded_hash;
+      typedef boost::unordered_flat_map<int, int, seeded_hash> container2;
+
+      container2 c2(c.begin(), c.end(), 0, seeded_hash(h1, 1234));
+      std::ostringstream oss2;
+      {
+        output_archive oa(oss2);
+        c2.save_layout(oa);
+      }
+
+      container2 c3(0, seeded_hash(h1, 1234));
+      container2 c4(0, seeded_hash(h1, 5678));
+      {
+        std::istringstream iss(oss2.str());
+        input_archive ia(iss);
+        calls = 0;
+        c3.load_layout(ia);
+        BOOST_TEST_EQ(calls, 0u);
+      }
+      {
+        std::istringstream iss(oss2.str());
+        input_archive ia(iss);
+        calls = 0;
+        c4.load_layout(ia);
+        BOOST_TEST_EQ(calls, c.size());
+      }
+      BOOST_TEST(std::equal(c2.begin(), c2.end(), c3.begin()));
+      BOOST_TEST(c2 == c4);
+      BOOST_TEST_EQ(c4.hash_function().seed(), 5678u);
+    }
+  }
+
+  template <class Container, typename ArchivePair>
+  void compact_serialization_tests(Container*, ArchivePair*)
+  {
+    typedef typename Container::value_type    value_type;
+    typedef typename ArchivePair::first_type  output_archive;
+    typedef typename ArchivePair::second_type input_archive;
+
+    std::mt19937_64 rng(4213);
+    std::size_t const sizes[] = {0, 1, 10000};
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+      BOOST_LIGHTWEIGHT_TEST_OSTREAM << "compact_serialization_tests, size "
+                                     << sizes[i] << "\n";
+
+      Container c;
+      while (c.size() < sizes[i]) {
+        std::uint64_t x = rng();
+        c.insert(make_compact_value((value_type*)0, x));
+      }
+
+      std::ostringstream oss;
+      {
+        output_archive oa(oss);
+        c.save_compact(oa);
+      }
+
+      Container c2;
+      c2.insert(make_compact_value((value_type*)0, 1));
+      std::istringstream iss(oss.str());
+      input_archive ia(iss);
+      c2.load_compact(ia);
+      BOOST_TEST(c == c2);
+    }
+  }
+
+  template <class Container, typename ArchivePair>
+  void async_serialization_tests(
+    Container*, ArchivePair*, test::random_generator generator)
+  {
+    using output_archive = typename ArchivePair::first_type;
+    using input_archive = typename ArchivePair::second_type;
+
+    test::random_values<Container> values(1000, generator);
+    Container c(values.begin(), values.end());
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "async_serialization_tests1\n";
+    std::stringstream ss;
+    {
+      boost::async_save<output_archive>(ss, c).get();
+      Container c2 =
+        boost::async_save<output_archive>(ss, Container(c)).get();
+      BOOST_TEST(c == c2);
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "async_serialization_tests2\n";
+    {
+      // data read ahead past the first archive is given back to ss
+      Container c2 = boost::async_load<input_archive, Container>(ss).get();
+      BOOST_TEST(c == c2);
+      Container c3 =
+        boost::async_load<input_archive>(ss, Container(0, test::hash(1)))
+          .get();
+      BOOST_TEST(c == c3);
+      BOOST_TEST(c3.hash_function() == test::hash(1));
+    }
+
+    BOOST_LIGHTWEIGHT_TEST_OSTREAM << "async_serialization_tests3\n";
+    {
+      std::string const str = ss.str();
+      std::istringstream iss(str.substr(0, str.size() / 4));
+      auto f = boost::async_load<input_archive, Container>(iss);
+      BOOST_TEST_THROWS(f.get(), std::exception);
+    }
+  }
+
+  void async_serialization_large_tests()
+  {
+    // spans several double buffering blocks
+    boost::unordered_flat_map<int, int> c;
+    for (int i = 0; i < 300000; ++i) {
+      c.emplace(i, -i);
+    }
+
+    std::stringstream ss;
+    boost::async_save<boost::archive::text_oarchive>(ss, c).get();
+    BOOST_TEST_GT(ss.str().size(), 2u * (1u << 20));
+
+    auto c2 = boost::async_load<boost::archive::text_iarchive,
+      boost::unordered_flat_map<int, int> >(ss)
+                .get();
+    BOOST_TEST(c == c2);
+  }
+#endif
+
   // used by legacy_serialization_test, passed as argv[1]
   const char* test_dir=".";
 
   using test::default_generator;
+  using test::generate_collisions;
 
   std::pair<
     boost::archive::text_oarchive, boost::archive::text_iarchive>*
@@ -132,11 +506,45 @@ namespace {
     test::object, test::hash, test::equal_to>* test_flat_set;
   boost::unordered_node_set<
     test::object, test::hash, test::equal_to>* test_node_set;
+  boost::unordered_flat_multimap<
+    test::object, test::object, test::hash, test::equal_to>* test_flat_multimap;
+  boost::unordered_node_multimap<
+    test::object, test::object, test::hash, test::equal_to>* test_node_multimap;
+  boost::unordered_flat_multiset<
+    test::object, test::hash, test::equal_to>* test_flat_multiset;
+  boost::unordered_node_multiset<
+    test::object, test::hash, test::equal_to>* test_node_multiset;
 
   UNORDERED_TEST(serialization_tests,
+    ((test_flat_map)(test_node_map)(test_flat_set)(test_node_set)
+     (test_flat_multimap)(test_node_multimap)
+     (test_flat_multiset)(test_node_multiset))
+    ((text_archive)(xml_archive))
+    ((default_generator)(generate_collisions)))
+
+  UNORDERED_TEST(layout_serialization_tests,
+    ((test_flat_map)(test_flat_set))
+    ((text_archive)(xml_archive))
+    ((default_generator)))
+
+  UNORDERED_TEST(fingerprint_layout_serialization_tests,
+    ((text_archive)(xml_archive)))
+
+  boost::unordered_flat_map<std::int64_t, std::uint32_t>* test_i64_u32_map;
+  boost::unordered_flat_set<std::int32_t>* test_i32_set;
+
+  UNORDERED_TEST(compact_serialization_tests,
+    ((test_i64_u32_map)(test_i32_set))
+    ((text_archive)(xml_archive)))
+
+  UNORDERED_TEST(async_serialization_tests,
     ((test_flat_map)(test_node_map)(test_flat_set)(test_node_set))
     ((text_archive)(xml_archive))
     ((default_generator)))
+
+  UNORDERED_AUTO_TEST (async_serialization_large) {
+    async_serialization_large_tests();
+  }
 #else
   boost::unordered_map<
     test::object, test::object, test::hash, test::equal_to>* test_map;
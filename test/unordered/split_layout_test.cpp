@@ -0,0 +1,308 @@
+// Copyright 2026 agent
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/concurrent_flat_map.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+
+struct big
+{
+    std::uint64_t id = 0;
+    unsigned char payload[ 248 ] = {};
+
+    big() = default;
+    explicit big( std::uint64_t id_ ): id( id_ ) { payload[ 0 ] = static_cast<unsigned char>( id_ ); }
+
+    friend bool operator==( big const& x, big const& y )
+    {
+        return x.id == y.id && x.payload[ 0 ] == y.payload[ 0 ];
+    }
+};
+
+namespace boost
+{
+namespace unordered
+{
+
+template<> struct flat_map_split_layout<std::uint64_t, big>: std::true_type
+{
+};
+
+} // namespace unordered
+} // namespace boost
+
+// few distinct reduced hashes and positions, to exercise tag collisions and overflow
+
+struct poor_hash
+{
+    std::size_t operator()( std::uint64_t x ) const
+    {
+        return static_cast<std::size_t>( ( x % 61 ) * 0x9E3779B97F4A7C15ull );
+    }
+};
+
+typedef boost::unordered_flat_map<std::uint64_t, big> map_type;
+typedef boost::unordered_flat_map<std::uint64_t, big, poor_hash> poor_map_type;
+
+template<class Map> static void check( Map const& m, std::map<std::uint64_t, big> const& ref )
+{
+    BOOST_TEST_EQ( m.size(), ref.size() );
+
+    for( auto const& x: ref )
+    {
+        auto it = m.find( x.first );
+
+        if( BOOST_TEST( it != m.end() ) )
+        {
+            BOOST_TEST_EQ( it->first, x.first );
+            BOOST_TEST( it->second == x.second );
+        }
+    }
+
+    for( auto const& x: m )
+    {
+        BOOST_TEST_EQ( ref.count( x.first ), 1u );
+    }
+}
+
+template<class Map> static void test_modifiers()
+{
+    Map m;
+    std::map<std::uint64_t, big> ref;
+
+    for( std::uint64_t i = 0; i < 2000; ++i )
+    {
+        std::uint64_t k = i * 7919;
+
+        if( i % 3 == 0 ) m.emplace( k, big( k ) );
+        else if( i % 3 == 1 ) m.try_emplace( k, k );
+        else m[ k ] = big( k );
+
+        ref.emplace( k, big( k ) );
+    }
+
+    check( m, ref );
+
+    BOOST_TEST( m.find( 1 ) == m.end() );
+    BOOST_TEST( !m.contains( 7919 * 2000 ) );
+    BOOST_TEST( !m.try_emplace( 0, 1 ).second );
+    BOOST_TEST_EQ( m.at( 7919 ).id, 7919u );
+
+    for( std::uint64_t i = 0; i < 2000; i += 2 )
+    {
+        std::uint64_t k = i * 7919;
+
+        if( i % 4 == 0 ) BOOST_TEST_EQ( m.erase( k ), 1u );
+        else m.erase( m.find( k ) );
+
+        ref.erase( k );
+    }
+
+    check( m, ref );
+
+    // slots of erased elements are reused with new keys
+
+    for( std::uint64_t i = 0; i < 500; ++i )
+    {
+        std::uint64_t k = i * 7919 + 1;
+
+        m.emplace( k, big( k ) );
+        ref.emplace( k, big( k ) );
+    }
+
+    check( m, ref );
+
+    m.rehash( 0 );
+    check( m, ref );
+
+    m.reserve( 20000 );
+    check( m, ref );
+
+    Map m2( m );
+    check( m2, ref );
+
+    Map m3;
+    m3.emplace( 1, big( 1 ) );
+    m3 = m;
+    check( m3, ref );
+
+    Map m4( std::move( m3 ) );
+    check( m4, ref );
+
+    Map m5;
+    m5.swap( m4 );
+    check( m5, ref );
+    BOOST_TEST( m4.empty() );
+
+    m5.clear();
+    BOOST_TEST( m5.empty() );
+    BOOST_TEST( m5.find( 0 ) == m5.end() );
+
+    m5.emplace( 0, big( 0 ) );
+    BOOST_TEST( m5.contains( 0 ) );
+}
+
+template<class Map> static void test_merge()
+{
+    Map m1, m2;
+    std::map<std::uint64_t, big> ref;
+
+    for( std::uint64_t i = 0; i < 1000; ++i )
+    {
+        std::uint64_t k = i * 31;
+
+        ( i % 2 ? m1 : m2 ).emplace( k, big( k ) );
+        ref.emplace( k, big( k ) );
+    }
+
+    m1.reserve( 2000 );
+    m2.reserve( 2000 );
+
+    m1.merge( m2 );
+
+    BOOST_TEST( m2.empty() );
+    check( m1, ref );
+}
+
+static void test_image()
+{
+    map_type m;
+    std::map<std::uint64_t, big> ref;
+
+    for( std::uint64_t i = 0; i < 1000; ++i )
+    {
+        m.emplace( i, big( i ) );
+        ref.emplace( i, big( i ) );
+    }
+
+    std::ostringstream oss;
+    m.save_image( oss );
+
+    map_type m2;
+    m2.emplace( 5000, big( 5000 ) );
+
+    std::istringstream iss( oss.str() );
+    m2.load_image( iss );
+
+    check( m2, ref );
+    BOOST_TEST( m2.find( 5000 ) == m2.end() );
+}
+
+static void test_concurrent_interop()
+{
+    map_type m;
+    std::map<std::uint64_t, big> ref;
+
+    for( std::uint64_t i = 0; i < 1000; ++i )
+    {
+        m.emplace( i, big( i ) );
+        ref.emplace( i, big( i ) );
+    }
+
+    boost::concurrent_flat_map<std::uint64_t, big> cm( std::move( m ) );
+
+    BOOST_TEST( m.empty() );
+    BOOST_TEST_EQ( cm.size(), ref.size() );
+
+    m.emplace( 1, big( 1 ) );
+    BOOST_TEST( m.contains( 1 ) );
+    m.clear();
+
+    map_type m2( std::move( cm ) );
+
+    BOOST_TEST_EQ( cm.size(), 0u );
+    check( m2, ref );
+}
+
+// fails allocation of key arrays on demand
+
+static bool fail_key_allocation = false;
+
+template<class T> struct key_failing_allocator
+{
+    typedef T value_type;
+
+    key_failing_allocator() = default;
+    template<class U> key_failing_allocator( key_failing_allocator<U> const& ) {}
+
+    T* allocate( std::size_t n )
+    {
+        if( fail_key_allocation && std::is_same<T, std::uint64_t>::value )
+        {
+            throw std::bad_alloc();
+        }
+
+        return std::allocator<T>().allocate( n );
+    }
+
+    void deallocate( T* p, std::size_t n )
+    {
+        std::allocator<T>().deallocate( p, n );
+    }
+
+    template<class U> bool operator==( key_failing_allocator<U> const& ) const { return true; }
+    template<class U> bool operator!=( key_failing_allocator<U> const& ) const { return false; }
+};
+
+static void test_concurrent_interop_exception()
+{
+    typedef key_failing_allocator<std::pair<std::uint64_t const, big> > allocator_type;
+    typedef boost::unordered_flat_map<std::uint64_t, big, boost::hash<std::uint64_t>, std::equal_to<std::uint64_t>, allocator_type> failing_map_type;
+    typedef boost::concurrent_flat_map<std::uint64_t, big, boost::hash<std::uint64_t>, std::equal_to<std::uint64_t>, allocator_type> concurrent_map_type;
+
+    concurrent_map_type cm;
+
+    for( std::uint64_t i = 0; i < 1000; ++i )
+    {
+        cm.emplace( i, big( i ) );
+    }
+
+    fail_key_allocation = true;
+
+    try
+    {
+        failing_map_type m( std::move( cm ) );
+        BOOST_ERROR( "exception expected" );
+    }
+    catch( std::bad_alloc const& )
+    {
+    }
+
+    fail_key_allocation = false;
+
+    // the concurrent map keeps its elements
+
+    BOOST_TEST_EQ( cm.size(), 1000u );
+
+    for( std::uint64_t i = 0; i < 1000; ++i )
+    {
+        BOOST_TEST( cm.visit( i, []( std::pair<std::uint64_t const, big> const& x ) { BOOST_TEST( x.second == big( x.first ) ); } ) );
+    }
+
+    failing_map_type m( std::move( cm ) );
+
+    BOOST_TEST_EQ( cm.size(), 0u );
+    BOOST_TEST_EQ( m.size(), 1000u );
+    BOOST_TEST( m.find( 999 ) != m.end() );
+}
+
+int main()
+{
+    test_modifiers<map_type>();
+    test_modifiers<poor_map_type>();
+    test_merge<map_type>();
+    test_image();
+    test_concurrent_interop();
+    test_concurrent_interop_exception();
+
+    return boost::report_errors();
+}
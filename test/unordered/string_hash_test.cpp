@@ -0,0 +1,158 @@
+// Copyright 2026 agent
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/unordered/string_hash.hpp>
+#include <boost/unordered/hash_traits.hpp>
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/unordered_flat_set.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/config.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+#include <string_view>
+#endif
+
+static int popcount(std::size_t x)
+{
+    int n = 0;
+    for( ; x; x &= x - 1 ) ++n;
+    return n;
+}
+
+static void test_traits()
+{
+    using boost::unordered::hash_is_avalanching;
+    using boost::unordered::detail::has_hash_fingerprint;
+
+    BOOST_TEST_TRAIT_TRUE((hash_is_avalanching<boost::string_hash>));
+    BOOST_TEST_TRAIT_TRUE((has_hash_fingerprint<boost::string_hash>));
+
+    boost::string_hash h1, h2( 1 );
+
+    BOOST_TEST_EQ( h1.seed(), 0u );
+    BOOST_TEST_EQ( h2.seed(), 1u );
+    BOOST_TEST_NE( h1.fingerprint(), h2.fingerprint() );
+    BOOST_TEST_EQ( h2.fingerprint(), boost::string_hash( 1 ).fingerprint() );
+}
+
+static void test_consistency()
+{
+    boost::string_hash h;
+
+    // all lengths up to several 48-byte blocks, so that every path is covered
+    std::string s;
+    boost::unordered_flat_set<std::size_t> hashes;
+
+    for( int i = 0; i < 300; ++i )
+    {
+        BOOST_TEST_EQ( h( s ), h( s.c_str() ) );
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+        BOOST_TEST_EQ( h( s ), h( std::string_view( s ) ) );
+#endif
+        BOOST_TEST( hashes.insert( h( s ) ).second );
+
+        s.push_back( static_cast<char>( 'a' + i % 26 ) );
+    }
+
+    // bytes beyond the string are not read
+    std::string buf1( 64, 'x' ), buf2( 64, 'y' );
+    for( std::size_t n = 0; n < 48; ++n )
+    {
+        buf1.replace( 0, n, n, 'z' );
+        buf2.replace( 0, n, n, 'z' );
+
+        BOOST_TEST_EQ(
+            boost::unordered::detail::string_hash_impl::hash( buf1.data(), n, 0 ),
+            boost::unordered::detail::string_hash_impl::hash( buf2.data(), n, 0 ) );
+    }
+
+    // seed changes hash values
+    boost::string_hash h2( 42 );
+    BOOST_TEST_NE( h( std::string( "hello" ) ), h2( std::string( "hello" ) ) );
+}
+
+static void test_avalanche()
+{
+    boost::string_hash h;
+    std::size_t const digits = sizeof( std::size_t ) * 8;
+
+    std::size_t const lengths[] = { 1, 3, 4, 7, 8, 15, 16, 17, 33, 48, 49, 100 };
+
+    for( std::size_t n: lengths )
+    {
+        std::string s( n, '\0' );
+        for( std::size_t i = 0; i < n; ++i ) s[ i ] = static_cast<char>( i * 37 + 11 );
+
+        std::size_t const h0 = h( s );
+        double total = 0;
+        int count = 0;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            for( int bit = 0; bit < 8; ++bit )
+            {
+                std::string s2 = s;
+                s2[ i ] = static_cast<char>( s2[ i ] ^ ( 1 << bit ) );
+
+                total += popcount( h0 ^ h( s2 ) );
+                ++count;
+            }
+        }
+
+        // about half of the bits change on average
+        double const avg = total / count;
+        BOOST_TEST_GT( avg, digits * 0.4 );
+        BOOST_TEST_LT( avg, digits * 0.6 );
+    }
+}
+
+struct transparent_equal_to
+{
+    using is_transparent = void;
+
+    template<class T, class U> bool operator()( T const& x, U const& y ) const
+    {
+        return x == y;
+    }
+};
+
+static void test_container()
+{
+    boost::unordered_flat_map<std::string, int, boost::string_hash, transparent_equal_to> m;
+
+    for( int i = 0; i < 1000; ++i )
+    {
+        m.emplace( "key_" + std::to_string( i ), i );
+    }
+
+    BOOST_TEST_EQ( m.size(), 1000u );
+
+    for( int i = 0; i < 1000; ++i )
+    {
+        std::string const k = "key_" + std::to_string( i );
+
+        auto it = m.find( k.c_str() );
+        BOOST_TEST( it != m.end() ) && BOOST_TEST_EQ( it->second, i );
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+        BOOST_TEST( m.contains( std::string_view( k ) ) );
+#endif
+    }
+
+    BOOST_TEST( m.find( "key_1000" ) == m.end() );
+}
+
+int main()
+{
+    test_traits();
+    test_consistency();
+    test_avalanche();
+    test_container();
+
+    return boost::report_errors();
+}